@@ -96,94 +96,1221 @@
 #define NEG_INF_F32 (-1.0F/0.0F)
 #endif
 
+/** Maximum number of FFT plans held by an FFT plan cache */
+#ifndef IFX_FFT_PLAN_CACHE_SIZE
+#define IFX_FFT_PLAN_CACHE_SIZE (4U)
+#endif
+
+/** Number of range bins transposed and transformed together by the Doppler FFT, the tile of
+ * IFX_DOPPLER_TILE_BINS * num_chirps_per_frame complex values should fit into the L1 data cache */
+#ifndef IFX_DOPPLER_TILE_BINS
+#define IFX_DOPPLER_TILE_BINS (8U)
+#endif
+
+/** Number of indices tracked by the stack bitmap of the in-place transpose in
+ * \ref ifx_doppler_cfft_inplace_f32, a multiple of 32, larger values reduce the cycle walks */
+#ifndef IFX_DOPPLER_INPLACE_BITMAP_BITS
+#define IFX_DOPPLER_INPLACE_BITMAP_BITS (1024U)
+#endif
+
+/** Number of window samples calculated by recurrence between two direct evaluations of the phase
+ * in \ref ifx_window_cosine_sum_fast_f32, smaller values reduce the error and the speedup */
+#ifndef IFX_WINDOW_FAST_BLOCK
+#define IFX_WINDOW_FAST_BLOCK (16U)
+#endif
+
+/** Maximum number of windows held by a window registry */
+#ifndef IFX_WINDOW_REGISTRY_SIZE
+#define IFX_WINDOW_REGISTRY_SIZE (8U)
+#endif
+
 /** PI/2 */
 #ifndef PI_2_F32
 #define PI_2_F32 (1.570796370506F)
 #endif
 
-/** PI/4 */
-#ifndef PI_4_F32
-#define PI_4_F32 (0.78539816339F)
-#endif
+/** PI/4 */
+#ifndef PI_4_F32
+#define PI_4_F32 (0.78539816339F)
+#endif
+
+/** Macro used to assign real part of a complex floating number */
+#define CREAL_F32(x)   (((float32_t *)       &(x))[0])
+
+/** Macro used to assign imaginary part of a complex floating number */
+#define CIMAG_F32(x)   (((float32_t *)       &(x))[1])
+
+/**********************************  Type definitions ************************************/
+
+/** Complex float number type */
+typedef _Complex float cfloat32_t;
+
+/**
+ * @brief Instance structure for the MTI calculation.
+ */
+typedef struct
+{
+    /**
+     *  Size of in_data, out_data, historical_data
+     */
+    uint32_t len;
+
+    /**
+     * Exponential moving average parameter (0 highest historical influence,
+     * 1 lowest)
+     */
+    float32_t alpha;
+
+    /**
+     * Pointer to historical data (size must be equal to len).
+     * Initiate with first data or zeros
+     */
+    float32_t* historical_data;
+} ifx_mti_inst_f32;
+
+/**
+ * @brief Peak search options.
+ */
+typedef struct
+{
+    float32_t height; /**< Required height of peaks */
+    float32_t threshold; /**< Required threshold of peaks, the vertical distance to its neighboring
+                            samples */
+    int32_t distance; /**< Required minimal horizontal distance (>= 1) in samples between
+                         neighbouring peaks */
+    int32_t width; /**< Required width of peaks in samples */
+} ifx_peak_search_opts_f32_t;
+
+/**
+ * @brief FFT types supported by an FFT plan.
+ */
+typedef enum
+{
+    IFX_FFT_TYPE_REAL = 0, /**< FFT of real data, i.e. range FFT of real raw radar data */
+    IFX_FFT_TYPE_COMPLEX,  /**< FFT of complex data, i.e. complex range FFT and Doppler FFT */
+    IFX_FFT_TYPE_REAL_PAIR /**< FFT of real data, two chirps are packed as real and imaginary
+                                part into one complex FFT, see \ref ifx_range_fft_oop_f32 */
+} ifx_fft_type_t;
+
+/**
+ * @brief Output format of the Doppler FFT.
+ */
+typedef enum
+{
+    IFX_DOPPLER_OUTPUT_COMPLEX = 0, /**< Complex Doppler spectrum */
+    IFX_DOPPLER_OUTPUT_MAGNITUDE,   /**< Magnitude \f$ |X| \f$ */
+    IFX_DOPPLER_OUTPUT_POWER,       /**< Power \f$ |X|^2 \f$ */
+    IFX_DOPPLER_OUTPUT_POWER_DB     /**< Log power \f$ 10 \log_{10} |X|^2 \f$, -inf if zero */
+} ifx_doppler_output_t;
+
+/**
+ * @brief Instance structure for the range and Doppler FFT plans.
+ *
+ * A plan holds the CMSIS-DSP FFT instance together with the preprocessing settings of
+ * one transform. All state lives in the plan, so different radars or threads can
+ * execute FFTs concurrently as long as each one uses its own plan.
+ */
+typedef struct
+{
+    /**
+     * FFT type
+     */
+    ifx_fft_type_t type;
+
+    /**
+     * FFT length
+     */
+    uint16_t fft_len;
+
+    /**
+     * If true, remove mean along samples before FFT
+     */
+    bool mean_removal;
+
+    /**
+     * Pointer to window of length num_samples applied prior to FFT, NULL if no windowing is
+     * desired. The window is not copied, it must stay valid as long as the plan is used.
+     */
+    const float32_t* win;
+
+    /**
+     * If true, win holds only the first (num_samples + 1) / 2 coefficients of a symmetric
+     * window, see \ref ifx_fft_plan_set_half_window_f32
+     */
+    bool win_half;
+
+    /**
+     * Complex window of num_samples coefficients used instead of win by plans of type
+     * IFX_FFT_TYPE_COMPLEX, NULL if not used, see \ref ifx_fft_plan_set_complex_window_f32
+     */
+    const cfloat32_t* cwin;
+
+    /**
+     * Number of input samples per FFT, smaller than fft_len if the input is zero padded,
+     * see \ref ifx_fft_plan_set_zero_padding_f32
+     */
+    uint16_t num_samples;
+
+    /**
+     * First FFT bin written by the range FFT, see \ref ifx_fft_plan_set_range_gate_f32
+     */
+    uint16_t first_bin;
+
+    /**
+     * Number of FFT bins written per chirp by the range FFT
+     */
+    uint16_t num_bins;
+
+    /**
+     * If true, the Doppler FFT output is in fftshift order with zero velocity at bin fft_len/2,
+     * see \ref ifx_fft_plan_set_fft_shift_f32
+     */
+    bool fft_shift;
+
+    /**
+     * CMSIS-DSP real FFT instance, used by plans of type IFX_FFT_TYPE_REAL
+     */
+    arm_rfft_fast_instance_f32 rfft;
+
+    /**
+     * CMSIS-DSP complex FFT instance, used by plans of type IFX_FFT_TYPE_COMPLEX and
+     * IFX_FFT_TYPE_REAL_PAIR. For the Bluestein algorithm it holds the power of two FFT of
+     * length bluestein_len.
+     */
+    arm_cfft_instance_f32 cfft;
+
+    /**
+     * Caller provided buffer with twiddle factors and work memory for complex FFT lengths not
+     * supported by CMSIS-DSP, NULL otherwise, see \ref ifx_fft_plan_init_buffer_f32
+     */
+    float32_t* buffer;
+
+    /**
+     * Length of the power of two convolution of the Bluestein algorithm, 0 if the FFT is
+     * calculated by CMSIS-DSP or by the mixed radix algorithm
+     */
+    uint16_t bluestein_len;
+} ifx_fft_plan_f32_t;
+
+/**
+ * @brief Instance structure for the FFT plan cache.
+ *
+ * The cache keeps up to IFX_FFT_PLAN_CACHE_SIZE initialized plans keyed by FFT type and
+ * length, so pipelines switching between a few FFT configurations do not re-initialize
+ * CMSIS-DSP instances on every frame. When the cache is full the least recently used plan
+ * is replaced. Cached plans are never handed out, each lookup copies one into a plan owned
+ * by the caller, so replacing an entry does not affect plans returned earlier.
+ */
+typedef struct
+{
+    /**
+     * Cached plans with default settings, the first num_plans entries are valid
+     */
+    ifx_fft_plan_f32_t plans[IFX_FFT_PLAN_CACHE_SIZE];
+
+    /**
+     * Lookup count of the last access per cached plan, used for replacement
+     */
+    uint32_t last_used[IFX_FFT_PLAN_CACHE_SIZE];
+
+    /**
+     * Number of valid plans in the cache
+     */
+    uint32_t num_plans;
+
+    /**
+     * Number of lookups which found an initialized plan
+     */
+    uint32_t hits;
+
+    /**
+     * Number of lookups which required a plan initialization
+     */
+    uint32_t misses;
+} ifx_fft_plan_cache_f32_t;
+
+/**
+ * @brief Window types of the window generators and the window registry.
+ */
+typedef enum
+{
+    IFX_WINDOW_HANN = 0,         /**< Hann window, see \ref ifx_window_hann_f32 */
+    IFX_WINDOW_HAMMING,          /**< Hamming window, see \ref ifx_window_hamming_f32 */
+    IFX_WINDOW_BLACKMAN,         /**< Blackman window, see \ref ifx_window_blackman_f32 */
+    IFX_WINDOW_BLACKMANHARRIS    /**< Four-term Blackman-Harris window, see
+                                      \ref ifx_window_blackmanharris_f32 */
+} ifx_window_type_t;
+
+/**
+ * @brief Window with precomputed gains.
+ *
+ * Holds the sums of a window needed to normalize spectra, so they are calculated once per
+ * window instead of once per frame. For a window \f$ w \f$ of length \f$ N \f$ an amplitude
+ * spectrum is normalized by \f$ 1 / \sum w_n \f$ and a power spectral density by
+ * \f$ 1 / \sum w_n^2 \f$, which can be folded into a single scale of the window or of the
+ * detection threshold. See \ref ifx_window_desc_init_f32.
+ */
+typedef struct
+{
+    const float32_t* win;    /**< Pointer to the window coefficients */
+    uint32_t len;            /**< Length of window */
+    float32_t sum;           /**< Sum of coefficients \f$ \sum w_n \f$ */
+    float32_t sum_sq;        /**< Sum of squared coefficients \f$ \sum w_n^2 \f$ */
+    float32_t coherent_gain; /**< Coherent gain \f$ \sum w_n / N \f$ */
+    float32_t enbw;          /**< Equivalent noise bandwidth in bins
+                                  \f$ N \sum w_n^2 / (\sum w_n)^2 \f$ */
+} ifx_window_desc_f32_t;
+
+/**
+ * @brief Entry of a window registry.
+ */
+typedef struct
+{
+    ifx_window_type_t type; /**< Window type */
+    uint32_t len;           /**< Window length */
+    bool periodic;          /**< True for a periodic, false for a symmetric window */
+    const float32_t* win;   /**< Pointer to the window coefficients */
+} ifx_window_registry_entry_f32_t;
+
+/**
+ * @brief Instance structure for the window registry.
+ *
+ * The registry hands out shared read-only windows keyed by type, length and symmetry. Each
+ * window is generated on its first request into a memory pool provided by the caller, so all
+ * users of the same window share one copy and it is generated only once.
+ */
+typedef struct
+{
+    /**
+     * Registered windows, the first num_entries entries are valid
+     */
+    ifx_window_registry_entry_f32_t entries[IFX_WINDOW_REGISTRY_SIZE];
+
+    /**
+     * Number of valid entries
+     */
+    uint32_t num_entries;
+
+    /**
+     * Pointer to the memory pool holding the generated windows
+     */
+    float32_t* pool;
+
+    /**
+     * Number of float32_t elements of the pool
+     */
+    uint32_t pool_len;
+
+    /**
+     * Number of pool elements in use
+     */
+    uint32_t pool_used;
+} ifx_window_registry_f32_t;
+
+/**
+ * @brief Memory layout of a radar data cube holding the raw data of several RX channels.
+ *
+ * All strides are given in elements. For a cube of shape [num_rx][num_chirps][num_samples]
+ * use rx_stride = num_chirps * num_samples, chirp_stride = num_samples and sample_stride = 1.
+ * For RX-interleaved data of shape [num_chirps][num_samples][num_rx], as read from the BGT60
+ * FIFO, use rx_stride = 1, chirp_stride = num_samples * num_rx and sample_stride = num_rx.
+ */
+typedef struct
+{
+    uint16_t num_rx;               /**< Number of RX channels */
+    uint16_t num_chirps_per_frame; /**< Number of chirps per radar frame */
+    uint32_t rx_stride;            /**< Distance between first samples of consecutive channels */
+    uint32_t chirp_stride;         /**< Distance between first samples of consecutive chirps */
+    uint32_t sample_stride;        /**< Distance between consecutive samples of a chirp */
+} ifx_radar_cube_layout_t;
+
+/**
+ * @brief Instance structure for the zoom FFT of a range plan.
+ *
+ * The zoom FFT evaluates the range spectrum on a grid refined by the zoom factor around a coarse
+ * range bin by a chirp-z transform. The chirp factors and the transformed convolution filter
+ * are precomputed into a caller provided buffer, see \ref ifx_zoom_fft_plan_init_f32.
+ */
+typedef struct
+{
+    const ifx_fft_plan_f32_t* plan; /**< Range plan providing fft_len, num_samples, mean
+                                         removal and window */
+    uint16_t zoom;                  /**< Number of points per range bin */
+    uint16_t num_points;            /**< Number of spectrum points per zoom FFT */
+    uint16_t conv_len;              /**< Power of two length of the chirp-z convolution */
+    arm_cfft_instance_f32 cfft;     /**< CMSIS-DSP complex FFT instance of length conv_len */
+    float32_t* buffer;              /**< Caller provided buffer of chirp factors and work memory */
+} ifx_zoom_fft_plan_f32_t;
+
+/**
+ * @brief Configuration of a range Doppler engine, see \ref ifx_range_doppler_init_f32.
+ */
+typedef struct
+{
+    ifx_fft_type_t input_type;      /**< IFX_FFT_TYPE_REAL or IFX_FFT_TYPE_COMPLEX raw data */
+    uint16_t num_samples_per_chirp; /**< Number of samples per chirp, range FFT length */
+    uint16_t num_chirps_per_frame;  /**< Number of chirps per frame, Doppler FFT length */
+    bool range_mean_removal;        /**< If true, remove mean along samples before range FFT */
+    const float32_t* range_win;     /**< Range window of num_samples_per_chirp, can be NULL */
+    bool doppler_mean_removal;      /**< If true, remove mean along chirps before Doppler FFT */
+    const float32_t* doppler_win;   /**< Doppler window of num_chirps_per_frame, can be NULL */
+    uint16_t first_range_bin;       /**< First range bin of the range gate */
+    uint16_t num_range_bins;        /**< Number of range bins of the range gate, 0 for all
+                                         range bins starting at first_range_bin */
+    bool fft_shift;                 /**< If true, Doppler output in fftshift order */
+    ifx_doppler_output_t output;    /**< Output format of the range Doppler map */
+    const cfloat32_t* range_cwin;   /**< Composite range window replacing range_win, only for
+                                         complex input, can be NULL */
+    const cfloat32_t* doppler_cwin; /**< Composite Doppler window replacing doppler_win, can be
+                                         NULL */
+} ifx_range_doppler_config_f32_t;
+
+/**
+ * @brief Instance structure of a range Doppler engine.
+ *
+ * The engine holds the range and Doppler FFT plans of one configuration and the pointers into
+ * the caller provided workspace, so a full range Doppler map is calculated by one call per
+ * frame without further buffers.
+ */
+typedef struct
+{
+    ifx_range_doppler_config_f32_t config; /**< Copy of the configuration */
+    ifx_fft_plan_f32_t range_plan;         /**< Range FFT plan */
+    ifx_fft_plan_f32_t doppler_plan;       /**< Doppler FFT plan */
+    cfloat32_t* range;                     /**< Range matrix in the workspace */
+    float32_t* scratch;                    /**< Range FFT scratch in the workspace */
+    cfloat32_t* doppler_scratch;           /**< Doppler tile scratch in the workspace, NULL
+                                                for complex output */
+} ifx_range_doppler_f32_t;
+
+/******************************* Function prototypes *************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Substracts the calculated array mean from each element of the floating point array.
+ *
+ * @param[in] v Pointer to input array
+ * @param[in] len Number of elements in array
+ * @return none
+ */
+void ifx_mean_removal_f32(float32_t* v, uint32_t len);
+
+
+/**
+ * @brief Substracts the calculated array mean from each element of the complex floating point
+ * array.
+ *
+ * @param[in] v Pointer to input array
+ * @param[in] len Number of elements in array
+ * @return none
+ */
+void ifx_cmplx_mean_removal_f32(cfloat32_t* v, uint32_t len);
+
+
+/**
+ * @brief Substracts the calculated array mean from each element of the floating point array and
+ * applies a window in a single pass.
+ *
+ * The mean is calculated in a read-only pass, then \f$ dst_n = (src_n - mean) \cdot win_n \f$ is
+ * calculated with one load and store per element, replacing the separate mean removal and window
+ * multiplication passes.
+ *
+ * @param[in] src Pointer to input array
+ * @param[out] dst Pointer to output array, can be equal to src for in-place processing
+ * @param[in] win Pointer to window of length len
+ * @note Can be NULL if not windowing is desired
+ * @param[in] len Number of elements in array
+ * @return none
+ */
+void ifx_mean_removal_window_f32(const float32_t* src,
+                                 float32_t* dst,
+                                 const float32_t* win,
+                                 uint32_t len);
+
+
+/**
+ * @brief Substracts the calculated array mean from each element of the complex floating point
+ * array and applies a real window in a single pass.
+ *
+ * @param[in] src Pointer to input array
+ * @param[out] dst Pointer to output array, can be equal to src for in-place processing
+ * @param[in] win Pointer to window of length len
+ * @note Can be NULL if not windowing is desired
+ * @param[in] len Number of elements in array
+ * @return none
+ */
+void ifx_cmplx_mean_removal_window_f32(const cfloat32_t* src,
+                                       cfloat32_t* dst,
+                                       const float32_t* win,
+                                       uint32_t len);
+
+
+/**
+ * @brief Initializes an FFT plan.
+ *
+ * The plan stores the CMSIS-DSP FFT instance for the given type and length along with the
+ * mean removal flag and the window pointer, so it can be passed to the range and Doppler
+ * FFT execute functions for every frame without re-initialization.
+ *
+ * @param[out] plan Pointer to plan previously allocated by the caller
+ * @param[in] type FFT type
+ * @param[in] fft_len FFT length
+ * @param[in] mean_removal If true, remove mean along samples before FFT
+ * @param[in] win Pointer to window to be applied prior to FFT, of length fft_len or of the
+ * number of input samples if zero padding is set
+ * @note Can be NULL if not windowing is desired
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Not supported FFT type or length, see
+ *           \ref ifx_fft_plan_init_buffer_f32 for complex FFT lengths other than powers of two
+ */
+int32_t ifx_fft_plan_init_f32(ifx_fft_plan_f32_t* plan,
+                              ifx_fft_type_t type,
+                              uint16_t fft_len,
+                              bool mean_removal,
+                              const float32_t* win);
+
+
+/**
+ * @brief Returns the buffer size needed by \ref ifx_fft_plan_init_buffer_f32.
+ *
+ * @param[in] type FFT type
+ * @param[in] fft_len FFT length
+ * @return Number of float32_t elements of the plan buffer, 0 if no buffer is needed because
+ * CMSIS-DSP supports the length or if the length is not supported at all
+ */
+uint32_t ifx_fft_plan_buffer_size_f32(ifx_fft_type_t type, uint16_t fft_len);
+
+
+/**
+ * @brief Initializes an FFT plan for any complex FFT length.
+ *
+ * Lengths supported by CMSIS-DSP are initialized as by \ref ifx_fft_plan_init_f32 and the
+ * buffer is not used. Other lengths of plans of type IFX_FFT_TYPE_COMPLEX use the caller
+ * provided buffer for twiddle factors and work memory:
+ * - lengths with prime factors 2, 3 and 5 only, i.e. 24 or 48 chirps, are calculated by a
+ *   mixed radix FFT with 4 * fft_len buffer elements
+ * - other lengths are calculated by the Bluestein algorithm as convolution with power of two
+ *   FFTs of length bluestein_len >= 2 * fft_len - 1, up to 4096
+ *
+ * The buffer is part of the plan and is written by every FFT, so a plan with buffer must not
+ * be executed concurrently. Functions processing real data still require power of two lengths.
+ *
+ * @param[out] plan Pointer to plan previously allocated by the caller
+ * @param[in] type FFT type
+ * @param[in] fft_len FFT length
+ * @param[in] mean_removal If true, remove mean along samples before FFT
+ * @param[in] win Pointer to window to be applied prior to FFT, of length fft_len
+ * @note Can be NULL if not windowing is desired
+ * @param[in] buffer Pointer to buffer of \ref ifx_fft_plan_buffer_size_f32 elements, must stay
+ * valid as long as the plan is used
+ * @param[in] buffer_len Number of elements of buffer
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Not supported FFT type or length, or buffer too
+ *           small
+ */
+int32_t ifx_fft_plan_init_buffer_f32(ifx_fft_plan_f32_t* plan,
+                                     ifx_fft_type_t type,
+                                     uint16_t fft_len,
+                                     bool mean_removal,
+                                     const float32_t* win,
+                                     float32_t* buffer,
+                                     uint32_t buffer_len);
+
+
+/**
+ * @brief Calculates the complex FFT of a plan of type IFX_FFT_TYPE_COMPLEX in-place.
+ *
+ * Dispatches to CMSIS-DSP, the mixed radix or the Bluestein FFT depending on how the plan was
+ * initialized. No mean removal or windowing is applied.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX
+ * @param[inout] data Pointer to fft_len complex values, replaced by their spectrum
+ * @return none
+ */
+void ifx_cfft_transform_f32(const ifx_fft_plan_f32_t* plan, cfloat32_t* data);
+
+
+/**
+ * @brief Sets the zero padding factor of the range FFT.
+ *
+ * With zero padding each chirp of the raw data holds fft_len/factor samples. Mean removal and
+ * windowing are applied to these samples only, the window must have fft_len/factor elements,
+ * then the remaining input of the FFT is filled with zeros in the FFT work buffer. This
+ * interpolates the range spectrum by factor without copying the raw data into a larger buffer.
+ * Zero padding is supported by the out-of-place, integer and cube range FFT functions.
+ *
+ * @param[inout] plan Pointer to plan, fft_len is the padded FFT length
+ * @param[in] factor Zero padding factor, 1 disables zero padding
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : fft_len is not a multiple of factor
+ */
+int32_t ifx_fft_plan_set_zero_padding_f32(ifx_fft_plan_f32_t* plan, uint16_t factor);
+
+
+/**
+ * @brief Restricts the output of the range FFT to a window of range bins.
+ *
+ * By default the range FFT writes all fft_len/2 bins (real data, IFX_FFT_TYPE_REAL and
+ * IFX_FFT_TYPE_REAL_PAIR) or fft_len bins (complex data) of each chirp. With a range gate only
+ * num_bins bins starting at first_bin are written, so the range data has the compact shape
+ * [num_chirps_per_frame][num_bins] and can be passed with num_range_bins = num_bins to the
+ * Doppler FFT, which then only processes the gated bins.
+ * For real data only the split stage of the gated bins is calculated.
+ *
+ * @param[inout] plan Pointer to plan
+ * @param[in] first_bin First range bin to be written
+ * @param[in] num_bins Number of range bins to be written
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Range gate exceeds the number of range bins
+ */
+int32_t ifx_fft_plan_set_range_gate_f32(ifx_fft_plan_f32_t* plan,
+                                        uint16_t first_bin,
+                                        uint16_t num_bins);
+
+
+/**
+ * @brief Enables fftshift output ordering of the Doppler FFT.
+ *
+ * With fftshift enabled the Doppler FFT functions write the Doppler bins of each range bin
+ * in the order of \ref ifx_shift_cfft_f32, zero velocity at bin fft_len/2, so no separate
+ * shift pass is needed. The input is modulated by \f$ (-1)^n \f$ after mean removal and
+ * windowing, which moves the spectrum by fft_len/2 bins.
+ *
+ * @param[inout] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX
+ * @param[in] fft_shift If true, output in fftshift order
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or fft_len
+ *           is odd
+ */
+int32_t ifx_fft_plan_set_fft_shift_f32(ifx_fft_plan_f32_t* plan, bool fft_shift);
+
+
+/**
+ * @brief Sets a half-length symmetric window in an FFT plan.
+ *
+ * The window holds only the first (num_samples + 1) / 2 coefficients of a symmetric window,
+ * see \ref ifx_window_half_f32, and is applied from both ends of each chirp. This halves the
+ * memory of the window compared to the full window set by \ref ifx_fft_plan_init_f32.
+ *
+ * @param[inout] plan Pointer to plan
+ * @param[in] half Pointer to half-length window, not copied, it must stay valid as long as the
+ * plan is used
+ * @return none
+ */
+void ifx_fft_plan_set_half_window_f32(ifx_fft_plan_f32_t* plan, const float32_t* half);
+
+
+/**
+ * @brief Sets a complex window in an FFT plan of type IFX_FFT_TYPE_COMPLEX.
+ *
+ * The complex window replaces the real window of the plan in the window multiply after mean
+ * removal. A composite window built by \ref ifx_window_composite_f32 merges window, FFT
+ * normalization and calibration gain, so the spectrum needs no scaling pass after the FFT.
+ *
+ * @param[inout] plan Pointer to plan
+ * @param[in] cwin Pointer to num_samples complex window coefficients, not copied, it must stay
+ * valid as long as the plan is used. NULL restores the real window.
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX
+ */
+int32_t ifx_fft_plan_set_complex_window_f32(ifx_fft_plan_f32_t* plan, const cfloat32_t* cwin);
+
+
+/**
+ * @brief Returns the window coefficient of sample n of an FFT plan.
+ *
+ * Resolves half-length windows by mirroring, for processing which reads the window per sample.
+ *
+ * @param[in] plan Pointer to plan
+ * @param[in] n Sample index smaller than num_samples
+ * @return Window coefficient, 1 if the plan has no window
+ */
+static inline float32_t ifx_fft_plan_win_f32(const ifx_fft_plan_f32_t* plan, uint32_t n)
+{
+    float32_t w = 1.0F;
+
+    if (plan->win != NULL)
+    {
+        const uint32_t mirror = (uint32_t)plan->num_samples - 1U - n;
+        w = (plan->win_half && (n > mirror)) ? plan->win[mirror] : plan->win[n];
+    }
+
+    return w;
+}
+
+
+/**
+ * @brief Releases an FFT plan.
+ *
+ * The plan does not own any memory, the function only resets it, so a released plan
+ * cannot be executed until it is initialized again.
+ *
+ * @param[inout] plan Pointer to plan
+ * @return none
+ */
+void ifx_fft_plan_destroy_f32(ifx_fft_plan_f32_t* plan);
+
+
+/**
+ * @brief Initializes an FFT plan cache.
+ *
+ * Empties the cache and resets the hit and miss counters.
+ *
+ * @param[out] cache Pointer to cache previously allocated by the caller
+ * @return none
+ */
+void ifx_fft_plan_cache_init_f32(ifx_fft_plan_cache_f32_t* cache);
+
+
+/**
+ * @brief Initializes a plan for the given FFT type and length from the cache.
+ *
+ * If the cache holds a plan of the given type and length it is copied into plan and the hit
+ * counter is incremented, otherwise a new plan is initialized and cached, possibly replacing
+ * the least recently used one, and the miss counter is incremented. The result equals
+ * \ref ifx_fft_plan_init_f32 with the same arguments without its initialization cost. The
+ * plan is owned by the caller, setting e.g. zero padding or range gate on it does not affect
+ * the cache or other plans, and it stays valid when the cache entry is replaced.
+ * Every call updates the cache, so a cache must not be shared between threads without locking,
+ * each thread or sensor should use its own cache. The entry points without plan argument, e.g.
+ * \ref ifx_range_fft_f32, use no cache and stay reentrant.
+ *
+ * @param[inout] cache Pointer to cache
+ * @param[in] type FFT type, real or complex
+ * @param[in] fft_len FFT length
+ * @param[in] mean_removal If true, remove mean along samples before FFT
+ * @param[in] win Pointer to window of length fft_len to be applied prior to FFT
+ * @note Can be NULL if not windowing is desired
+ * @param[out] plan Pointer to plan previously allocated by the caller
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Not supported FFT type or length
+ */
+int32_t ifx_fft_plan_cache_get_f32(ifx_fft_plan_cache_f32_t* cache,
+                                   ifx_fft_type_t type,
+                                   uint16_t fft_len,
+                                   bool mean_removal,
+                                   const float32_t* win,
+                                   ifx_fft_plan_f32_t* plan);
+
+
+/**
+ * @brief Calculate range FFT of one chirp of real data which has already been mean removed
+ * and windowed.
+ * Only the bins of the range gate configured in the plan are written.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_REAL
+ * @param[inout] work Pointer to chirp data of fft_len elements, the contents are destroyed
+ * @param[out] range Pointer to range complex data of num_bins elements, must not overlap
+ * with work
+ * @return none
+ */
+void ifx_range_fft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                 float32_t* work,
+                                 cfloat32_t* range);
+
+
+/**
+ * @brief Calculate range FFT of one chirp of complex data which has already been mean removed
+ * and windowed.
+ * The FFT is calculated in-place in work, then the bins of the range gate configured in the plan
+ * are moved to range.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX
+ * @param[inout] work Pointer to chirp data of fft_len elements, replaced by its FFT
+ * @param[out] range Pointer to range complex data of num_bins elements, can be equal to work or
+ * overlap with it if range is not behind work
+ * @return none
+ */
+void ifx_range_cfft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                  cfloat32_t* work,
+                                  cfloat32_t* range);
+
+
+/**
+ * @brief Calculate range FFT from real floating point raw radar data using an FFT plan.
+ * Perform mean removal and windowing as configured in the plan prior to 1D FFT.
+ * The caller must allocate the memory for the frame and range arrays.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_REAL, fft_len equals the number of
+ * samples per chirp
+ * @param[inout] frame Pointer to raw radar real data of shape
+ * [num_chirps_per_frame][fft_len]
+ * @note frame is modified by this function
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_chirps_per_frame][num_bins], num_bins is fft_len/2 if no range gate is set
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_REAL or zero
+ *           padding is set
+ */
+int32_t ifx_range_fft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                               float32_t* frame,
+                               cfloat32_t* range,
+                               uint16_t num_chirps_per_frame);
+
+
+/**
+ * @brief Calculate range FFT from real floating point raw radar data using an FFT plan,
+ * without modifying the raw data.
+ * Mean removal and windowing as configured in the plan are applied while copying each chirp
+ * into the scratch buffer, which is then transformed. The raw radar data can therefore be
+ * used for other purposes, i.e. logging or interference detection, without copying it first.
+ *
+ * With a plan of type IFX_FFT_TYPE_REAL_PAIR two consecutive chirps are packed as real and
+ * imaginary part into the scratch buffer and transformed by one complex FFT of length fft_len.
+ * The spectra of both chirps are then separated using the conjugate symmetry of real signals,
+ * \f$ A_k = (Z_k + Z^*_{N-k})/2 \f$ and \f$ B_k = (Z_k - Z^*_{N-k})/2j \f$, so a frame
+ * takes half the number of FFT calls. With an odd number of chirps the last chirp is
+ * transformed alone.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_REAL or IFX_FFT_TYPE_REAL_PAIR, fft_len
+ * equals the number of samples per chirp
+ * @param[in] frame Pointer to raw radar real data of shape
+ * [num_chirps_per_frame][num_samples], num_samples is fft_len if no zero padding is set
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_chirps_per_frame][num_bins], num_bins is fft_len/2 if no range gate is set
+ * @param[out] scratch Pointer to work buffer of fft_len elements, 2 * fft_len elements for plans
+ * of type IFX_FFT_TYPE_REAL_PAIR, the contents are destroyed
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_REAL or
+ *           IFX_FFT_TYPE_REAL_PAIR
+ */
+int32_t ifx_range_fft_oop_f32(const ifx_fft_plan_f32_t* plan,
+                              const float32_t* frame,
+                              cfloat32_t* range,
+                              float32_t* scratch,
+                              uint16_t num_chirps_per_frame);
+
+
+/**
+ * @brief Calculate range FFT from complex floating point raw radar data using an FFT plan.
+ * Perform mean removal and windowing as configured in the plan prior to 1D FFT.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * samples per chirp
+ * @param[inout] frame Pointer to raw radar complex data of shape
+ * [num_chirps_per_frame][fft_len]
+ * @note Processing by this function occurs in-place. The raw radar complex data is replaced by the
+ * calculated range FFT of shape [num_chirps_per_frame][num_bins], num_bins is fft_len if no
+ * range gate is set
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or zero
+ *           padding is set
+ */
+int32_t ifx_range_cfft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                                cfloat32_t* frame,
+                                uint16_t num_chirps_per_frame);
+
+
+/**
+ * @brief Calculate range FFT from complex floating point raw radar data using an FFT plan,
+ * without modifying the raw data.
+ * Mean removal and windowing as configured in the plan are applied while copying each chirp
+ * into the range array, where it is then transformed in-place.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * samples per chirp
+ * @param[in] frame Pointer to raw radar complex data of shape
+ * [num_chirps_per_frame][num_samples], num_samples is fft_len if no zero padding is set
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_chirps_per_frame][fft_len]
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or a
+ *           range gate is set, use \ref ifx_range_cfft_exec_f32 for gated complex data
+ */
+int32_t ifx_range_cfft_oop_f32(const ifx_fft_plan_f32_t* plan,
+                               const cfloat32_t* frame,
+                               cfloat32_t* range,
+                               uint16_t num_chirps_per_frame);
+
+
+/**
+ * @brief Calculate range FFT from real integer raw ADC data using an FFT plan.
+ * The conversion to floating point \f$ x_n = (adc_n - offset) \cdot scale \f$ is fused with the
+ * mean removal and windowing configured in the plan into a single pass writing the scratch buffer,
+ * so no floating point copy of the frame is needed. If mean removal is enabled the offset is
+ * replaced by the mean of each chirp.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_REAL, fft_len equals the number of
+ * samples per chirp
+ * @param[in] frame Pointer to raw ADC data of shape [num_chirps_per_frame][num_samples],
+ * i.e. 12-bit samples stored in uint16_t
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_chirps_per_frame][num_bins], num_bins is fft_len/2 if no range gate is set
+ * @param[out] scratch Pointer to work buffer of fft_len elements, the contents are destroyed
+ * @param[in] offset ADC value corresponding to zero, i.e. 2048 for 12-bit samples
+ * @param[in] scale Scale factor from ADC value to floating point, i.e. 1/2048 for 12-bit samples
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_REAL
+ */
+int32_t ifx_range_fft_u16_f32(const ifx_fft_plan_f32_t* plan,
+                              const uint16_t* frame,
+                              cfloat32_t* range,
+                              float32_t* scratch,
+                              float32_t offset,
+                              float32_t scale,
+                              uint16_t num_chirps_per_frame);
+
+
+/**
+ * @brief Calculate range FFT from complex integer raw ADC data using an FFT plan.
+ * The conversion to floating point is fused with the mean removal and windowing configured in the
+ * plan into a single pass writing the range array, where the FFT is then calculated in-place.
+ * If mean removal is enabled the offset is replaced by the mean of each chirp, separately for
+ * the I and Q components.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * samples per chirp
+ * @param[in] frame Pointer to raw ADC data of shape [num_chirps_per_frame][num_samples][2] with
+ * interleaved I and Q samples, i.e. 12-bit samples stored in uint16_t
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_chirps_per_frame][fft_len]
+ * @param[in] offset ADC value corresponding to zero, i.e. 2048 for 12-bit samples
+ * @param[in] scale Scale factor from ADC value to floating point, i.e. 1/2048 for 12-bit samples
+ * @param[in] num_chirps_per_frame Number of chirps per radar frame
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or a
+ *           range gate is set, use \ref ifx_range_cfft_exec_f32 for gated complex data
+ */
+int32_t ifx_range_cfft_u16_f32(const ifx_fft_plan_f32_t* plan,
+                               const uint16_t* frame,
+                               cfloat32_t* range,
+                               float32_t offset,
+                               float32_t scale,
+                               uint16_t num_chirps_per_frame);
+
 
-/** Macro used to assign real part of a complex floating number */
-#define CREAL_F32(x)   (((float32_t *)       &(x))[0])
+/**
+ * @brief Calculate range FFT for all RX channels of a real floating point radar data cube.
+ * Perform mean removal and windowing as configured in the plan prior to 1D FFT. The cube is
+ * read according to the given layout and not modified, each chirp is gathered into the scratch
+ * buffer fused with mean removal and windowing.
+ * If the library is built with IFX_SENSOR_DSP_USE_OPENMP defined, the RX channels are processed
+ * in parallel.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_REAL, fft_len equals the number of
+ * samples per chirp
+ * @param[in] cube Pointer to raw radar real data
+ * @param[in] layout Pointer to memory layout of the cube
+ * @param[out] range Pointer to transformed range complex data of shape
+ * [num_rx][num_chirps_per_frame][num_bins], num_bins is fft_len/2 if no range gate is set
+ * @param[out] scratch Pointer to work buffer of num_rx * fft_len elements, one slice of fft_len
+ * elements per RX channel independent of the OpenMP build, the contents are destroyed
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_REAL
+ */
+int32_t ifx_range_fft_cube_f32(const ifx_fft_plan_f32_t* plan,
+                               const float32_t* cube,
+                               const ifx_radar_cube_layout_t* layout,
+                               cfloat32_t* range,
+                               float32_t* scratch);
 
-/** Macro used to assign imaginary part of a complex floating number */
-#define CIMAG_F32(x)   (((float32_t *)       &(x))[1])
 
-/**********************************  Type definitions ************************************/
+/**
+ * @brief Returns the buffer size needed by \ref ifx_zoom_fft_plan_init_f32.
+ *
+ * @param[in] plan Pointer to range plan
+ * @param[in] num_points Number of spectrum points per zoom FFT
+ * @return Number of float32_t elements of the zoom plan buffer, 0 if the chirp-z convolution
+ * of num_samples + num_points - 1 points exceeds the largest CMSIS-DSP FFT length of 4096
+ */
+uint32_t ifx_zoom_fft_buffer_size_f32(const ifx_fft_plan_f32_t* plan, uint16_t num_points);
 
-/** Complex float number type */
-typedef _Complex float cfloat32_t;
 
 /**
- * @brief Instance structure for the MTI calculation.
+ * @brief Initializes a zoom FFT plan for refining the range spectrum of a range plan.
+ *
+ * The zoom FFT calculates num_points points of the range spectrum spaced by 1/zoom range
+ * bins. This corresponds to zero padding the chirp by the factor zoom, but only the points
+ * around a detected target are calculated. The cost is the one of two complex FFTs of
+ * length conv_len >= num_samples + num_points - 1, independent of the zoom factor.
+ *
+ * @param[out] zoom_plan Pointer to zoom plan previously allocated by the caller
+ * @param[in] plan Pointer to range plan of type IFX_FFT_TYPE_REAL or IFX_FFT_TYPE_REAL_PAIR, its
+ * mean removal, window and zero padding are used, it must stay valid as long as the zoom plan is
+ * used
+ * @param[in] zoom Zoom factor, number of spectrum points per range bin
+ * @param[in] num_points Number of spectrum points per zoom FFT
+ * @param[in] buffer Pointer to buffer of \ref ifx_zoom_fft_buffer_size_f32 elements, must stay
+ * valid as long as the zoom plan is used
+ * @param[in] buffer_len Number of elements of buffer
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not real, zoom or num_points is
+ *           zero or buffer too small
  */
-typedef struct
-{
-    /**
-     *  Size of in_data, out_data, historical_data
-     */
-    uint32_t len;
+int32_t ifx_zoom_fft_plan_init_f32(ifx_zoom_fft_plan_f32_t* zoom_plan,
+                                   const ifx_fft_plan_f32_t* plan,
+                                   uint16_t zoom,
+                                   uint16_t num_points,
+                                   float32_t* buffer,
+                                   uint32_t buffer_len);
 
-    /**
-     * Exponential moving average parameter (0 highest historical influence,
-     * 1 lowest)
-     */
-    float32_t alpha;
 
-    /**
-     * Pointer to historical data (size must be equal to len).
-     * Initiate with first data or zeros
-     */
-    float32_t* historical_data;
-} ifx_mti_inst_f32;
+/**
+ * @brief Calculate the refined range spectrum of one chirp around a coarse range bin.
+ * Mean removal and windowing are applied as configured in the range plan. Point k of the
+ * spectrum is located at range bin peak_bin + (k - num_points/2) / zoom, points at whole range
+ * bins equal the output of the range FFT of the range plan.
+ * The zoom plan buffer is used as work memory, so a zoom plan must not be executed concurrently.
+ *
+ * @param[in] zoom_plan Pointer to zoom plan
+ * @param[in] chirp Pointer to num_samples raw radar real samples of one chirp, not modified
+ * @param[in] peak_bin Coarse range bin the spectrum points are centered on
+ * @param[out] spectrum Pointer to num_points complex spectrum points
+ * @return none
+ */
+void ifx_range_zoom_fft_f32(const ifx_zoom_fft_plan_f32_t* zoom_plan,
+                            const float32_t* chirp,
+                            uint16_t peak_bin,
+                            cfloat32_t* spectrum);
+
 
 /**
- * @brief Peak search options.
+ * @brief Returns the workspace size needed by a range Doppler engine.
+ *
+ * The workspace holds the range matrix, the range FFT scratch, the Doppler tile scratch for real
+ * valued output formats and the plan buffers for chirp or sample counts which are not a power of
+ * two, see \ref ifx_fft_plan_init_buffer_f32.
+ *
+ * @param[in] config Pointer to engine configuration
+ * @return Number of float32_t elements of the workspace
  */
-typedef struct
-{
-    float32_t height; /**< Required height of peaks */
-    float32_t threshold; /**< Required threshold of peaks, the vertical distance to its neighboring
-                            samples */
-    int32_t distance; /**< Required minimal horizontal distance (>= 1) in samples between
-                         neighbouring peaks */
-    int32_t width; /**< Required width of peaks in samples */
-} ifx_peak_search_opts_f32_t;
+uint32_t ifx_range_doppler_workspace_size_f32(const ifx_range_doppler_config_f32_t* config);
 
-/******************************* Function prototypes *************************************/
 
-#ifdef __cplusplus
-extern "C" {
-#endif
+/**
+ * @brief Initializes a range Doppler engine.
+ *
+ * All lengths are validated and the range and Doppler FFT plans are initialized once. Real raw
+ * data is transformed pairwise with a plan of type IFX_FFT_TYPE_REAL_PAIR, so the number of
+ * samples per chirp must be a power of two. For complex raw data any number of samples and for
+ * both any number of chirps is supported.
+ *
+ * @param[out] engine Pointer to engine previously allocated by the caller
+ * @param[in] config Pointer to engine configuration, it is copied, the windows are not copied
+ * and must stay valid as long as the engine is used
+ * @param[in] workspace Pointer to workspace of \ref ifx_range_doppler_workspace_size_f32
+ * elements, must stay valid as long as the engine is used
+ * @param[in] workspace_len Number of elements of workspace
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Not supported input type or length, range gate
+ *           exceeds the number of range bins, range_cwin set for real input or workspace too
+ *           small
+ */
+int32_t ifx_range_doppler_init_f32(ifx_range_doppler_f32_t* engine,
+                                   const ifx_range_doppler_config_f32_t* config,
+                                   float32_t* workspace,
+                                   uint32_t workspace_len);
+
 
 /**
- * @brief Substracts the calculated array mean from each element of the floating point array.
+ * @brief Calculate the range Doppler map of one frame with a range Doppler engine.
+ * The range FFT of all chirps is written into the workspace, followed by the Doppler FFT of the
+ * range bins of the range gate. The raw data is not modified. The workspace is written, so an
+ * engine must not be executed concurrently.
  *
- * @param[in] v Pointer to input array
- * @param[in] len Number of elements in array
- * @return none
+ * @param[in] engine Pointer to engine
+ * @param[in] frame Pointer to raw radar data of shape
+ * [num_chirps_per_frame][num_samples_per_chirp], complex data as interleaved real and imaginary
+ * parts
+ * @param[out] rd_map Pointer to range doppler map of shape
+ * [num_range_bins][num_chirps_per_frame], of type cfloat32_t for IFX_DOPPLER_OUTPUT_COMPLEX and
+ * of type float32_t for the other output formats
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
  */
-void ifx_mean_removal_f32(float32_t* v, uint32_t len);
+int32_t ifx_range_doppler_exec_f32(const ifx_range_doppler_f32_t* engine,
+                                   const float32_t* frame,
+                                   void* rd_map);
 
 
 /**
- * @brief Substracts the calculated array mean from each element of the complex floating point
- * array.
+ * @brief Calculate doppler FFT from range data using an FFT plan.
+ * Perform mean removal and windowing as configured in the plan prior to 1D FFT.
+ * The caller must allocate the memory for the range and doppler arrays.
  *
- * @param[in] v Pointer to input array
- * @param[in] len Number of elements in array
+ * The range data is processed in tiles of \ref IFX_DOPPLER_TILE_BINS range bins: the slow time
+ * columns of a tile are gathered into their doppler rows and transformed while they are still
+ * cached, instead of transposing the whole frame first. The range data is not modified.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[in] range Pointer to range complex data of shape
+ * [fft_len][num_range_bins]
+ * @param[out] doppler Pointer to transformed range doppler complex data of shape
+ * [num_range_bins][fft_len]
+ * @param[in] num_range_bins Number of range bins per chirp, the number of gated bins if the range
+ * FFT was calculated with a range gate
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX
+ */
+int32_t ifx_doppler_cfft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                                  cfloat32_t* range,
+                                  cfloat32_t* doppler,
+                                  uint16_t num_range_bins);
+
+
+/**
+ * @brief Calculate the real valued range doppler map from range data using an FFT plan.
+ * Like \ref ifx_doppler_cfft_exec_f32, but each tile of range bins is transformed in the
+ * scratch buffer and only the magnitude, power or log power of the Doppler spectrum is written
+ * to the map. This halves the output memory compared to the complex map and saves the separate
+ * pass over it.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[in] range Pointer to range complex data of shape [fft_len][num_range_bins], not modified
+ * @param[out] map Pointer to range doppler map of shape [num_range_bins][fft_len]
+ * @param[in] num_range_bins Number of range bins per chirp
+ * @param[in] output Output format, IFX_DOPPLER_OUTPUT_MAGNITUDE, IFX_DOPPLER_OUTPUT_POWER or
+ * IFX_DOPPLER_OUTPUT_POWER_DB
+ * @param[out] scratch Pointer to work buffer of IFX_DOPPLER_TILE_BINS * fft_len complex elements
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or output
+ *           format is IFX_DOPPLER_OUTPUT_COMPLEX
+ */
+int32_t ifx_doppler_cfft_map_f32(const ifx_fft_plan_f32_t* plan,
+                                 const cfloat32_t* range,
+                                 float32_t* map,
+                                 uint16_t num_range_bins,
+                                 ifx_doppler_output_t output,
+                                 cfloat32_t* scratch);
+
+
+/**
+ * @brief Calculate the Doppler FFT of one antenna and add its power to an integration map.
+ * Non-coherent integration over several RX antennas: the power \f$ |X|^2 \f$ of the Doppler
+ * spectrum is added to the map, so only one real valued map is kept for all antennas. The
+ * complex Doppler spectra of the listed range bins are written as well, i.e. for angle
+ * estimation of targets selected by a range profile detection.
+ * The map must be cleared by the caller before the first antenna, i.e. with arm_fill_f32.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[in] range Pointer to range complex data of one antenna of shape
+ * [fft_len][num_range_bins], not modified
+ * @param[in] num_range_bins Number of range bins per chirp
+ * @param[inout] map Pointer to integration map of shape [num_range_bins][fft_len]
+ * @param[in] range_bins Pointer to array of num_selected_bins range bin indices, can be NULL if
+ * num_selected_bins is zero
+ * @param[in] num_selected_bins Number of selected range bins
+ * @param[out] selected Pointer to complex Doppler spectra of this antenna of shape
+ * [num_selected_bins][fft_len], row i holds range bin range_bins[i], can be NULL if
+ * num_selected_bins is zero
+ * @param[out] scratch Pointer to work buffer of IFX_DOPPLER_TILE_BINS * fft_len complex elements
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or a range
+ *           bin index is not smaller than num_range_bins
+ */
+int32_t ifx_doppler_cfft_integrate_f32(const ifx_fft_plan_f32_t* plan,
+                                       const cfloat32_t* range,
+                                       uint16_t num_range_bins,
+                                       float32_t* map,
+                                       const uint16_t* range_bins,
+                                       uint16_t num_selected_bins,
+                                       cfloat32_t* selected,
+                                       cfloat32_t* scratch);
+
+
+/**
+ * @brief Calculate doppler FFT of one range bin in-place using an FFT plan.
+ * Mean removal, windowing and fftshift ordering are applied as configured in the plan. This
+ * is the per range bin step of the Doppler FFT functions, for callers that gather the slow
+ * time samples of a range bin themselves.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[inout] samples Pointer to fft_len slow time complex samples of one range bin, replaced
+ * by its Doppler spectrum
  * @return none
  */
-void ifx_cmplx_mean_removal_f32(cfloat32_t* v, uint32_t len);
+void ifx_doppler_cfft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                    cfloat32_t* samples);
+
+
+/**
+ * @brief Calculate doppler FFT from range data in-place using an FFT plan.
+ * The range data is transposed in-place to shape [num_range_bins][fft_len], then each row is
+ * transformed with mean removal and windowing as configured in the plan. This produces the same
+ * result as \ref ifx_doppler_cfft_exec_f32 without a second frame sized buffer.
+ * The transpose follows the permutation cycles with a stack bitmap of
+ * IFX_DOPPLER_INPLACE_BITMAP_BITS bits. It takes about 2 to 5 index steps per element for common
+ * frame shapes, the worst case is in the order of N * ceil(N / IFX_DOPPLER_INPLACE_BITMAP_BITS)
+ * steps with N = fft_len * num_range_bins.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[inout] range Pointer to range complex data of shape [fft_len][num_range_bins], replaced
+ * by the range doppler complex data of shape [num_range_bins][fft_len]
+ * @param[in] num_range_bins Number of range bins per chirp, any value from 0 to 65535, with 0
+ * the range data is left untouched
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX
+ */
+int32_t ifx_doppler_cfft_inplace_f32(const ifx_fft_plan_f32_t* plan,
+                                     cfloat32_t* range,
+                                     uint16_t num_range_bins);
+
+
+/**
+ * @brief Calculate doppler FFT along the columns of the range data in-place using an FFT plan.
+ * Each slow time column is copied into the scratch buffer, transformed with mean removal and
+ * windowing as configured in the plan and written back, so the result keeps the
+ * [doppler][range] order of the input and no transpose is needed.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[inout] range Pointer to range complex data of shape [fft_len][num_range_bins], replaced
+ * by the doppler range complex data of shape [fft_len][num_range_bins]
+ * @param[out] scratch Pointer to work buffer of fft_len complex elements
+ * @param[in] num_range_bins Number of range bins per chirp
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX
+ */
+int32_t ifx_doppler_cfft_columns_f32(const ifx_fft_plan_f32_t* plan,
+                                     cfloat32_t* range,
+                                     cfloat32_t* scratch,
+                                     uint16_t num_range_bins);
+
+
+/**
+ * @brief Calculate doppler FFT of selected range bins only using an FFT plan.
+ * Only the slow time columns of the listed range bins are gathered and transformed with mean
+ * removal, windowing and fftshift as configured in the plan, so the cost scales with the number
+ * of targets instead of the number of range bins.
+ *
+ * @param[in] plan Pointer to plan of type IFX_FFT_TYPE_COMPLEX, fft_len equals the number of
+ * chirps per frame
+ * @param[in] range Pointer to range complex data of shape [fft_len][num_range_bins]
+ * @param[in] num_range_bins Number of range bins per chirp
+ * @param[in] range_bins Pointer to array of num_selected_bins range bin indices
+ * @param[in] num_selected_bins Number of selected range bins
+ * @param[out] doppler Pointer to range doppler complex data of shape [num_selected_bins][fft_len],
+ * row i holds the Doppler spectrum of range bin range_bins[i]
+ * @return - \ref IFX_SENSOR_DSP_STATUS_OK : Operation successful
+ *         - \ref IFX_SENSOR_DSP_ARGUMENT_ERROR : Plan type is not IFX_FFT_TYPE_COMPLEX or a range
+ *           bin index is not smaller than num_range_bins
+ */
+int32_t ifx_doppler_cfft_sparse_f32(const ifx_fft_plan_f32_t* plan,
+                                    const cfloat32_t* range,
+                                    uint16_t num_range_bins,
+                                    const uint16_t* range_bins,
+                                    uint16_t num_selected_bins,
+                                    cfloat32_t* doppler);
 
 
 /**
  * @brief Calculate range FFT from real floating point raw radar data.
  * Perform optional mean removal and windowing on the raw radar data prior to 1D FFT.
  * The caller must allocate the memory for the frame and range arrays.
+ * The function initializes a temporary FFT plan on every call and is therefore reentrant,
+ * see \ref ifx_range_fft_exec_f32 to reuse a plan across frames.
  *
  * @param[inout] frame Pointer to raw radar real data of shape
  * [num_chirps_per_frame][num_adc_samples]
@@ -210,6 +1337,8 @@ int32_t ifx_range_fft_f32(float32_t* frame,
  * @brief Calculate range FFT from complex floating point raw radar data.
  * Perform optional mean removal and windowing on the ADC data prior to 1D FFT
  * The caller must allocate the memory for the frame and range arrays.
+ * The function initializes a temporary FFT plan on every call and is therefore reentrant,
+ * see \ref ifx_range_cfft_exec_f32 to reuse a plan across frames.
  *
  * @param[inout] frame Pointer to raw radar complex data of shape
  * [num_chirps_per_frame][num_adc_samples]
@@ -234,6 +1363,8 @@ int32_t ifx_range_cfft_f32(cfloat32_t* frame,
  * @brief Calculate doppler FFT from range data.
  * Perform optional mean removal and windowing on the range data prior to 1D FFT.
  * The caller must allocate the memory for the range and doppler arrays.
+ * The function initializes a temporary FFT plan on every call and is therefore reentrant,
+ * see \ref ifx_doppler_cfft_exec_f32 to reuse a plan across frames.
  *
  * @param[in] range Pointer to range complex data of shape
  * [num_chirps_per_frame][num_range_bins]
@@ -347,6 +1478,322 @@ void ifx_window_hamming_f32(float32_t* win, uint32_t len);
 void ifx_window_hann_f32(float32_t* win, uint32_t len);
 
 
+/**
+ * @brief Generate a symmetric Kaiser window.
+ *
+ * The function generates a symmetric Kaiser window \f$w\f$ of length \f$N\f$
+ * using the following formula
+   \f[
+   w_n = \frac{I_0\left( \beta \sqrt{1 - \left( \frac{2n}{N-1} - 1 \right)^2} \right)}
+   {I_0(\beta)},\qquad \mathrm{0} \le\ n < \mathrm{N}
+   \f]
+ * where \f$ I_0 \f$ is the zeroth order modified Bessel function of the first kind. The shape
+ * parameter \f$ \beta \f$ trades main lobe width against sidelobe level, \f$ \beta = 0 \f$
+ * is rectangular, \f$ \beta \approx 8.6 \f$ is similar to a Blackman window.
+ *
+ * @param[inout] win Starting pointer to float32_t array to be populated with output
+ * @param[in] len Length of window to be generated, at least 2
+ * @param[in] beta Shape parameter, not negative
+ * @return None
+ */
+void ifx_window_kaiser_f32(float32_t* win, uint32_t len, float32_t beta);
+
+
+/**
+ * @brief Generate a symmetric Dolph-Chebyshev window.
+ *
+ * The Dolph-Chebyshev window has the narrowest main lobe for equiripple sidelobes at a given
+ * attenuation below the main lobe. It is calculated as inverse DFT of the Chebyshev polynomial
+ * \f$ T_{N-1}(\beta \cos(\pi k / N)) \f$ with
+ * \f$ \beta = \cosh(\mathrm{acosh}(10^{A/20}) / (N-1)) \f$ and normalized to a maximum of 1.
+ * The calculation takes \f$ O(N^2) \f$ operations, so the window should be generated during
+ * initialization. Single precision limits the achieved attenuation to about 90 dB.
+ * Unlike the other window functions it requires the C math library (acosf, acoshf, coshf, powf).
+ *
+ * @param[inout] win Starting pointer to float32_t array to be populated with output
+ * @param[in] len Length of window to be generated, at least 2
+ * @param[in] attenuation Sidelobe attenuation \f$ A \f$ in dB, e.g. 60
+ * @return None
+ */
+void ifx_window_chebyshev_f32(float32_t* win, uint32_t len, float32_t attenuation);
+
+
+/**
+ * @brief Generate a symmetric Tukey (tapered cosine) window.
+ *
+ * The function generates a symmetric Tukey window \f$w\f$ of length \f$N\f$, which is flat
+ * except for a cosine taper over \f$ \alpha (N-1) / 2 \f$ samples at each end
+   \f[
+   w_n = \begin{cases}
+   \frac{1}{2} \left( 1 - \cos\left( \frac{2\pi n}{\alpha (N-1)} \right) \right), &
+   0 \le n < \frac{\alpha (N-1)}{2} \\
+   1, & \frac{\alpha (N-1)}{2} \le n \le \frac{N-1}{2}
+   \end{cases},\qquad w_n = w_{N-1-n}
+   \f]
+ * \f$ \alpha = 0 \f$ is rectangular, \f$ \alpha = 1 \f$ is a Hann window.
+ *
+ * @param[inout] win Starting pointer to float32_t array to be populated with output
+ * @param[in] len Length of window to be generated, at least 2
+ * @param[in] alpha Fraction of the window inside the cosine tapers, limited to 0 ... 1
+ * @return None
+ */
+void ifx_window_tukey_f32(float32_t* win, uint32_t len, float32_t alpha);
+
+
+/**
+ * @brief Initializes a window descriptor with the sums and gains of a window.
+ *
+ * The sum of the window must be nonzero, as the equivalent noise bandwidth is divided by its
+ * square.
+ *
+ * @param[out] desc Pointer to descriptor
+ * @param[in] win Pointer to window, not copied, it must stay valid as long as the descriptor is
+ * used
+ * @param[in] len Length of window
+ * @return None
+ */
+void ifx_window_desc_init_f32(ifx_window_desc_f32_t* desc, const float32_t* win, uint32_t len);
+
+
+/**
+ * @brief Generate a generalized cosine-sum window.
+ *
+ * The function generates a window \f$w\f$ of length \f$N\f$ from K coefficients
+ * using the following formula
+   \f[
+   w_n = \sum_{k=0}^{K-1} (-1)^k \mathrm{a_k} \cos\left( \frac{2\pi k n}{D} \right),
+   \qquad \mathrm{0} \le\ n < \mathrm{N}
+   \f]
+ * with \f$ D = N - 1 \f$ for a symmetric and \f$ D = N \f$ for a periodic window. Hann,
+ * Hamming, Blackman and Blackman-Harris windows are cosine-sum windows with 2, 2, 3 and 4
+ * coefficients. A periodic window is used for spectral analysis, i.e. if the window should
+ * continue seamlessly over consecutive frames.
+ *
+ * @param[out] win Pointer to window of length len
+ * @param[in] len Length of window to be generated, at least 2 for a symmetric window
+ * @param[in] coeffs Pointer to num_coeffs coefficients \f$ a_k \f$
+ * @param[in] num_coeffs Number of coefficients
+ * @param[in] periodic If true, generate a periodic instead of a symmetric window
+ * @return None
+ */
+void ifx_window_cosine_sum_f32(float32_t* win,
+                               uint32_t len,
+                               const float32_t* coeffs,
+                               uint32_t num_coeffs,
+                               bool periodic);
+
+
+/**
+ * @brief Generate a window of the given type.
+ *
+ * @param[in] type Window type
+ * @param[out] win Pointer to window of length len
+ * @param[in] len Length of window to be generated, at least 2 for a symmetric window
+ * @param[in] periodic If true, generate a periodic instead of a symmetric window
+ * @return None
+ */
+void ifx_window_f32(ifx_window_type_t type, float32_t* win, uint32_t len, bool periodic);
+
+
+/**
+ * @brief Returns a constant window table generated at build time.
+ *
+ * The tables are generated by scripts/gen_window_tables.py into source/ifx_window_tables_f32.c
+ * for chosen window types and lengths, the default set are the four window types with 32 and 64
+ * samples. A table is compiled in only if IFX_WINDOW_ALL_TABLES or its own macro
+ * IFX_WINDOW_TABLE_<TYPE>_<LEN>, e.g. IFX_WINDOW_TABLE_HANN_64, is defined, with suffix
+ * _PERIODIC for a periodic window. Tables are placed in flash and need no startup time.
+ * \ref ifx_window_registry_get_f32 returns a table if one matches, without using the pool.
+ *
+ * @param[in] type Window type
+ * @param[in] len Length of window
+ * @param[in] periodic True for a periodic, false for a symmetric window
+ * @return Pointer to the window table, NULL if no table matches
+ */
+const float32_t* ifx_window_table_get_f32(ifx_window_type_t type, uint32_t len, bool periodic);
+
+
+/**
+ * @brief Generate the first half of a symmetric window of the given type.
+ *
+ * Symmetric windows satisfy \f$ w_n = w_{N-1-n} \f$, so only the first \f$ \lceil N/2 \rceil \f$
+ * coefficients are generated and stored. They are applied with
+ * \ref ifx_window_half_apply_f32 and \ref ifx_cmplx_window_half_apply_f32 or by an FFT plan,
+ * see \ref ifx_fft_plan_set_half_window_f32.
+ *
+ * @param[in] type Window type
+ * @param[out] half Pointer to (len + 1) / 2 window coefficients
+ * @param[in] len Length of the full window, at least 2
+ * @return None
+ */
+void ifx_window_half_f32(ifx_window_type_t type, float32_t* half, uint32_t len);
+
+
+/**
+ * @brief Generate a cosine-sum window without evaluating trigonometric functions per sample.
+ *
+ * Same window as \ref ifx_window_cosine_sum_f32, for fast reconfiguration if the window length
+ * changes at runtime. Only the first half is calculated and mirrored. The phase
+ * \f$ e^{2\pi i n / D} \f$ is advanced by one complex rotation per sample and evaluated by
+ * polynomials every \ref IFX_WINDOW_FAST_BLOCK samples, the higher harmonics are derived by the
+ * Chebyshev recurrence \f$ \cos(k\theta) = 2\cos\theta\cos((k-1)\theta) - \cos((k-2)\theta) \f$.
+ * The rotation and the anchors do not use the table based arm_cos_f32 and arm_sin_f32.
+ * With the default \ref IFX_WINDOW_FAST_BLOCK the result differs from the exact cosine sum by
+ * less than 2e-6 (1.05e-6 measured) for the built-in Hann, Hamming, Blackman and
+ * Blackman-Harris windows up to a length of 4096. \ref ifx_window_cosine_sum_f32 itself deviates
+ * by up to about 1.1e-5 with the CMSIS-DSP table functions, so the two differ by up to about
+ * 1.2e-5. The bound does not apply to other coefficients, the error grows with the order and
+ * magnitude of the coefficients and with the block size.
+ *
+ * @param[out] win Pointer to window of length len
+ * @param[in] len Length of window to be generated, at least 2 for a symmetric window
+ * @param[in] coeffs Pointer to num_coeffs coefficients \f$ a_k \f$
+ * @param[in] num_coeffs Number of coefficients
+ * @param[in] periodic If true, generate a periodic instead of a symmetric window
+ * @return None
+ */
+void ifx_window_cosine_sum_fast_f32(float32_t* win,
+                                    uint32_t len,
+                                    const float32_t* coeffs,
+                                    uint32_t num_coeffs,
+                                    bool periodic);
+
+
+/**
+ * @brief Generate a window of the given type by recurrence, see
+ * \ref ifx_window_cosine_sum_fast_f32.
+ *
+ * @param[in] type Window type
+ * @param[out] win Pointer to window of length len
+ * @param[in] len Length of window to be generated, at least 2 for a symmetric window
+ * @param[in] periodic If true, generate a periodic instead of a symmetric window
+ * @return None
+ */
+void ifx_window_fast_f32(ifx_window_type_t type, float32_t* win, uint32_t len, bool periodic);
+
+
+/**
+ * @brief Applies a half-length symmetric window to a real array with optional mean removal.
+ * The array is processed from both ends, each coefficient is loaded once for two samples.
+ *
+ * @param[in] src Pointer to input array
+ * @param[out] dst Pointer to output array, can be equal to src for in-place processing
+ * @param[in] half Pointer to (len + 1) / 2 window coefficients
+ * @param[in] mean_removal If true, subtract the mean of src before windowing
+ * @param[in] len Number of elements in array
+ * @return None
+ */
+void ifx_window_half_apply_f32(const float32_t* src,
+                               float32_t* dst,
+                               const float32_t* half,
+                               bool mean_removal,
+                               uint32_t len);
+
+
+/**
+ * @brief Applies a half-length symmetric real window to a complex array with optional mean
+ * removal.
+ * The array is processed from both ends, each coefficient is loaded once for two samples.
+ *
+ * @param[in] src Pointer to input array
+ * @param[out] dst Pointer to output array, can be equal to src for in-place processing
+ * @param[in] half Pointer to (len + 1) / 2 window coefficients
+ * @param[in] mean_removal If true, subtract the mean of src before windowing
+ * @param[in] len Number of elements in array
+ * @return None
+ */
+void ifx_cmplx_window_half_apply_f32(const cfloat32_t* src,
+                                     cfloat32_t* dst,
+                                     const float32_t* half,
+                                     bool mean_removal,
+                                     uint32_t len);
+
+
+/**
+ * @brief Build a composite window merging window, normalization and calibration gain.
+ *
+ * The function generates \f$ c_n = w_n \cdot s \cdot g \f$ with the real window \f$ w \f$, a
+ * real scale \f$ s \f$, e.g. \f$ 1/N \f$ or \f$ 1/\sum w_n \f$ for FFT normalization, see
+ * \ref ifx_window_desc_f32_t, and the complex calibration gain \f$ g \f$ of a channel. By
+ * linearity of the FFT, windowing with \f$ c \f$ gives the same spectrum as windowing with
+ * \f$ w \f$ and scaling the spectrum by \f$ s g \f$ afterwards, without the extra passes.
+ * The composite window is used by COMPLEX FFT plans, see
+ * \ref ifx_fft_plan_set_complex_window_f32.
+ *
+ * Real input can only be windowed by a real window. For real input, the amplitude
+ * \f$ s |g| \f$ is folded into the range window by arm_scale_f32, and the phase
+ * \f$ g / |g| \f$ of the channel, which is constant over all samples and chirps, is folded into
+ * the composite Doppler window by this function with \f$ s = 1 \f$.
+ *
+ * @param[in] win Pointer to real window, NULL for a rectangular window
+ * @param[in] len Length of window
+ * @param[in] scale Real scale \f$ s \f$
+ * @param[in] gain Complex calibration gain \f$ g \f$
+ * @param[out] cwin Pointer to composite window of length len
+ * @return None
+ */
+void ifx_window_composite_f32(const float32_t* win,
+                              uint32_t len,
+                              float32_t scale,
+                              cfloat32_t gain,
+                              cfloat32_t* cwin);
+
+
+/**
+ * @brief Applies a complex window to a complex array with optional mean removal.
+ * Mean removal and windowing are done in a single pass over the output.
+ *
+ * @param[in] src Pointer to input array
+ * @param[out] dst Pointer to output array, can be equal to src for in-place processing
+ * @param[in] cwin Pointer to len complex window coefficients
+ * @param[in] mean_removal If true, subtract the mean of src before windowing
+ * @param[in] len Number of elements in array
+ * @return None
+ */
+void ifx_cmplx_window_composite_apply_f32(const cfloat32_t* src,
+                                          cfloat32_t* dst,
+                                          const cfloat32_t* cwin,
+                                          bool mean_removal,
+                                          uint32_t len);
+
+
+/**
+ * @brief Initializes a window registry.
+ *
+ * @param[out] registry Pointer to registry previously allocated by the caller
+ * @param[in] pool Pointer to memory pool for the generated windows, must stay valid as long as
+ * the registry and its windows are used
+ * @param[in] pool_len Number of float32_t elements of the pool
+ * @return None
+ */
+void ifx_window_registry_init_f32(ifx_window_registry_f32_t* registry,
+                                  float32_t* pool,
+                                  uint32_t pool_len);
+
+
+/**
+ * @brief Returns a shared window from the registry.
+ *
+ * If a constant window table of the given type, length and symmetry is compiled in, see
+ * \ref ifx_window_table_get_f32, it is returned. If the registry holds the window it is
+ * returned, otherwise it is generated into the pool on this first request. The returned window is
+ * shared by all users and must not be modified, it stays valid as long as the registry is not
+ * initialized again. The registry is not thread safe, windows should be requested during
+ * initialization.
+ *
+ * @param[inout] registry Pointer to registry
+ * @param[in] type Window type
+ * @param[in] len Window length, at least 2 for a symmetric window
+ * @param[in] periodic If true, periodic instead of symmetric window
+ * @return Pointer to window of length len, NULL if the registry or the pool is full or the
+ * length is invalid
+ */
+const float32_t* ifx_window_registry_get_f32(ifx_window_registry_f32_t* registry,
+                                             ifx_window_type_t type,
+                                             uint32_t len,
+                                             bool periodic);
+
+
 /**
  * @brief Generate a steering vector for AOA estimation given the theta range, number of beams, and
  * number of antennas
@@ -397,6 +1844,32 @@ arm_status ifx_angle_dbf_f32(const arm_matrix_instance_f32* pInput,
 void ifx_shift_cfft_f32(cfloat32_t* v, uint32_t len, uint32_t dim);
 
 
+/**
+ * @brief Shift the array of complex numbers out-of-place
+ * Same ordering as \ref ifx_shift_cfft_f32, each row is written with two block copies.
+ *
+ * @param[in] src Pointer to input array of dim rows with len elements
+ * @param[out] dst Pointer to output array of dim rows with len elements, must not overlap src
+ * @param[in] len Number of elements in array
+ * @param[in] dim Number of matrix dimensions
+ * @return None
+ */
+void ifx_shift_cfft_oop_f32(const cfloat32_t* src, cfloat32_t* dst, uint32_t len, uint32_t dim);
+
+
+/**
+ * @brief Shift both axes of a complex matrix, i.e. a range doppler map
+ * Moves element [r][c] to [(r + num_rows/2) % num_rows][(c + num_cols/2) % num_cols]. For even
+ * dimensions the diagonal quadrants are swapped in a single pass.
+ *
+ * @param[inout] map Pointer to matrix of shape [num_rows][num_cols]
+ * @param[in] num_rows Number of rows
+ * @param[in] num_cols Number of columns
+ * @return None
+ */
+void ifx_shift_cfft_2d_f32(cfloat32_t* map, uint32_t num_rows, uint32_t num_cols);
+
+
 /**
  * @brief Initializes MTI control structure
  *
@@ -474,6 +1947,8 @@ void ifx_flip_f32(float32_t* v, uint32_t len);
 
 /**
  * @brief Rotate the array of float numbers
+ * Moves the elements k positions to the front, the first k elements wrap around to the end.
+ * The rotation is done by three reversals in linear time.
  *
  * @param[inout] v Pointer to input array
  * @param[in] len Number of elements in array
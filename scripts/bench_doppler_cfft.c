@@ -0,0 +1,148 @@
+/***************************************************************************//**
+* \file bench_doppler_cfft.c
+*
+* \brief
+* Host benchmark of ifx_doppler_cfft_exec_f32 against the full matrix transpose used before
+* the range bins were processed in tiles
+*
+* Build on the host together with the library sources and CMSIS-DSP, e.g.
+*
+*     gcc -O2 -Iinclude -I<CMSIS-DSP>/Include -I<CMSIS-Core>/Include -o bench_doppler_cfft \
+*         scripts/bench_doppler_cfft.c <library sources> <CMSIS-DSP sources> -lm
+*
+* The tile size can be tuned with -DIFX_DOPPLER_TILE_BINS=<n>. Both variants are run
+* alternately NUM_REPEATS times and the fastest average per frame of each is reported.
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ifx_sensor_dsp.h"
+
+#define MAX_CHIRPS     (256U)
+#define MAX_RANGE_BINS (256U)
+#define NUM_RUNS       (200U)
+#define NUM_REPEATS    (20U)
+
+static cfloat32_t range[MAX_CHIRPS * MAX_RANGE_BINS];
+static cfloat32_t doppler_ref[MAX_CHIRPS * MAX_RANGE_BINS];
+static cfloat32_t doppler[MAX_CHIRPS * MAX_RANGE_BINS];
+static float32_t win[MAX_CHIRPS];
+
+/** @brief Doppler FFT with a transpose of the whole frame, as before the tiled implementation */
+static void doppler_cfft_transpose(const ifx_fft_plan_f32_t* plan,
+                                   cfloat32_t* in,
+                                   cfloat32_t* out,
+                                   uint16_t num_range_bins)
+{
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    arm_matrix_instance_f32 range_matrix = { num_chirps_per_frame, num_range_bins,
+                                             (float32_t*)in };
+    arm_matrix_instance_f32 doppler_matrix = { num_range_bins, num_chirps_per_frame,
+                                               (float32_t*)out };
+
+    (void)arm_mat_cmplx_trans_f32(&range_matrix, &doppler_matrix);
+
+    for (uint32_t range_idx = 0; range_idx < num_range_bins; ++range_idx)
+    {
+        ifx_doppler_cfft_transform_f32(plan, out);
+
+        out += num_chirps_per_frame;
+    }
+}
+
+
+static double now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e6) + ((double)ts.tv_nsec * 1e-3);
+}
+
+
+static void bench(uint16_t num_chirps_per_frame, uint16_t num_range_bins)
+{
+    ifx_fft_plan_f32_t plan;
+    const uint32_t num_samples = (uint32_t)num_chirps_per_frame * num_range_bins;
+
+    ifx_window_hann_f32(win, num_chirps_per_frame);
+    if (ifx_fft_plan_init_f32(&plan, IFX_FFT_TYPE_COMPLEX, num_chirps_per_frame, true, win) !=
+        IFX_SENSOR_DSP_STATUS_OK)
+    {
+        printf("%u x %u: FFT length not supported\n", num_chirps_per_frame, num_range_bins);
+        return;
+    }
+
+    for (uint32_t n = 0; n < num_samples; ++n)
+    {
+        range[n] = cosf(0.01F * (float32_t)n) + (sinf(0.03F * (float32_t)n) * I);
+    }
+
+    double transpose_us = INFINITY;
+    double tiled_us = INFINITY;
+
+    for (uint32_t repeat = 0; repeat < NUM_REPEATS; ++repeat)
+    {
+        double start = now_us();
+        for (uint32_t run = 0; run < NUM_RUNS; ++run)
+        {
+            doppler_cfft_transpose(&plan, range, doppler_ref, num_range_bins);
+        }
+        transpose_us = fmin(transpose_us, (now_us() - start) / (double)NUM_RUNS);
+
+        start = now_us();
+        for (uint32_t run = 0; run < NUM_RUNS; ++run)
+        {
+            (void)ifx_doppler_cfft_exec_f32(&plan, range, doppler, num_range_bins);
+        }
+        tiled_us = fmin(tiled_us, (now_us() - start) / (double)NUM_RUNS);
+    }
+
+    float32_t max_diff = 0.0F;
+    for (uint32_t n = 0; n < num_samples; ++n)
+    {
+        const float32_t diff = cabsf(doppler[n] - doppler_ref[n]);
+        max_diff = (diff > max_diff) ? diff : max_diff;
+    }
+
+    printf("%3u chirps x %3u range bins: transpose %8.2f us, tiled %8.2f us, speedup %.2f, "
+           "max diff %g\n", num_chirps_per_frame, num_range_bins, transpose_us, tiled_us,
+           transpose_us / tiled_us, (double)max_diff);
+}
+
+
+int main(void)
+{
+    printf("IFX_DOPPLER_TILE_BINS = %u, best of %u x %u runs\n", IFX_DOPPLER_TILE_BINS, NUM_REPEATS,
+           NUM_RUNS);
+
+    bench(64U, 64U);
+    bench(256U, 128U);
+    bench(128U, 256U);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/***************************************************************************//**
+* \file bench_window_fast.c
+*
+* \brief
+* Host benchmark of ifx_window_fast_f32 against ifx_window_f32, with the maximum error of both
+* against a double precision reference
+*
+* Build on the host together with the library sources and CMSIS-DSP, e.g.
+*
+*     gcc -O2 -Iinclude -I<CMSIS-DSP>/Include -I<CMSIS-Core>/Include -o bench_window_fast \
+*         scripts/bench_window_fast.c <library sources> <CMSIS-DSP sources> -lm
+*
+* The block size of the recurrence can be tuned with -DIFX_WINDOW_FAST_BLOCK=<n>. Both
+* generators are run alternately NUM_REPEATS times and the fastest average per window of each
+* is reported. The error is the maximum over both symmetries and all lengths from 2 to
+* MAX_LEN.
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ifx_sensor_dsp.h"
+
+#define MAX_LEN     (4096U)
+#define NUM_RUNS    (200U)
+#define NUM_REPEATS (20U)
+#define PI_F64      (3.14159265358979323846)
+
+/** Cosine-sum coefficients of the window types in double precision */
+static const double coeffs[4][4] =
+{
+    {0.5, 0.5, 0.0, 0.0},
+    {0.54, 0.46, 0.0, 0.0},
+    {0.42, 0.50, 0.08, 0.0},
+    {0.35875, 0.48829, 0.14128, 0.01168}
+};
+
+static const char* const names[4] = {"Hann", "Hamming", "Blackman", "Blackman-Harris"};
+
+static float32_t win[MAX_LEN];
+static float32_t win_fast[MAX_LEN];
+
+static double now_us(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((double)ts.tv_sec * 1e6) + ((double)ts.tv_nsec * 1e-3);
+}
+
+
+/** @brief Maximum deviation of a generated window from the double precision reference */
+static double max_error(ifx_window_type_t type, const float32_t* w, uint32_t len, bool periodic)
+{
+    const double D = periodic ? (double)len : ((double)len - 1.0);
+    double max = 0.0;
+
+    for (uint32_t n = 0; n < len; ++n)
+    {
+        double ref = 0.0;
+
+        for (uint32_t k = 0; k < 4U; ++k)
+        {
+            const double term = coeffs[type][k] * cos(2.0 * PI_F64 * (double)k * (double)n / D);
+            ref = ((k % 2U) == 1U) ? (ref - term) : (ref + term);
+        }
+
+        max = fmax(max, fabs((double)w[n] - ref));
+    }
+
+    return max;
+}
+
+
+static void bench_error(ifx_window_type_t type)
+{
+    double error = 0.0;
+    double error_fast = 0.0;
+
+    for (uint32_t len = 2U; len <= MAX_LEN; ++len)
+    {
+        for (uint32_t p = 0; p < 2U; ++p)
+        {
+            const bool periodic = (p == 1U);
+
+            ifx_window_f32(type, win, len, periodic);
+            ifx_window_fast_f32(type, win_fast, len, periodic);
+
+            error = fmax(error, max_error(type, win, len, periodic));
+            error_fast = fmax(error_fast, max_error(type, win_fast, len, periodic));
+        }
+    }
+
+    printf("%-15s max error: ifx_window_f32 %.3g, ifx_window_fast_f32 %.3g\n", names[type],
+           error, error_fast);
+}
+
+
+static void bench_time(ifx_window_type_t type, uint32_t len)
+{
+    double time_us = INFINITY;
+    double time_fast_us = INFINITY;
+
+    for (uint32_t repeat = 0; repeat < NUM_REPEATS; ++repeat)
+    {
+        double start = now_us();
+        for (uint32_t run = 0; run < NUM_RUNS; ++run)
+        {
+            ifx_window_f32(type, win, len, false);
+        }
+        time_us = fmin(time_us, (now_us() - start) / (double)NUM_RUNS);
+
+        start = now_us();
+        for (uint32_t run = 0; run < NUM_RUNS; ++run)
+        {
+            ifx_window_fast_f32(type, win_fast, len, false);
+        }
+        time_fast_us = fmin(time_fast_us, (now_us() - start) / (double)NUM_RUNS);
+    }
+
+    printf("%-15s %4u: ifx_window_f32 %8.2f us, ifx_window_fast_f32 %8.2f us, speedup %.2f\n",
+           names[type], len, time_us, time_fast_us, time_us / time_fast_us);
+}
+
+
+int main(void)
+{
+    static const uint32_t lengths[] = {64U, 256U, 1024U, 4096U};
+
+    printf("IFX_WINDOW_FAST_BLOCK = %u, best of %u x %u runs\n", IFX_WINDOW_FAST_BLOCK,
+           NUM_REPEATS, NUM_RUNS);
+
+    for (uint32_t type = 0; type < 4U; ++type)
+    {
+        for (uint32_t i = 0; i < (sizeof(lengths) / sizeof(lengths[0])); ++i)
+        {
+            bench_time((ifx_window_type_t)type, lengths[i]);
+        }
+    }
+
+    for (uint32_t type = 0; type < 4U; ++type)
+    {
+        bench_error((ifx_window_type_t)type);
+    }
+
+    return 0;
+}
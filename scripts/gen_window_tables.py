@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# Copyright 2022 Infineon Technologies AG
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate source/ifx_window_tables_f32.c with constant window tables.
+
+Each window is given as TYPE:LEN or TYPE:LEN:periodic, TYPE is one of hann, hamming, blackman
+and blackmanharris. The windows are calculated in double precision and rounded to float32_t.
+Every table is compiled only if IFX_WINDOW_ALL_TABLES or its own IFX_WINDOW_TABLE_<TYPE>_<LEN>
+(with suffix _PERIODIC for periodic windows) is defined, so unused tables cost no flash.
+
+Example:
+    python3 scripts/gen_window_tables.py hann:64 hann:32 blackmanharris:64
+"""
+
+import argparse
+import math
+import os
+import struct
+
+# Cosine-sum coefficients, must match source/ifx_window_f32.c
+WINDOWS = {
+    "hann": ("IFX_WINDOW_HANN", [0.5, 0.5]),
+    "hamming": ("IFX_WINDOW_HAMMING", [0.54, 0.46]),
+    "blackman": ("IFX_WINDOW_BLACKMAN", [0.42, 0.50, 0.08]),
+    "blackmanharris": ("IFX_WINDOW_BLACKMANHARRIS", [0.35875, 0.48829, 0.14128, 0.01168]),
+}
+
+DEFAULT_WINDOWS = [f"{name}:{length}" for name in WINDOWS for length in (32, 64)]
+
+HEADER = """/***************************************************************************//**
+* \\file ifx_window_tables_f32.c
+*
+* \\brief
+* This file contains the implementation for the
+* ifx_window_table_get_f32 function
+*
+* Generated by scripts/gen_window_tables.py, do not edit.
+*
+*******************************************************************************
+* \\copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+"""
+
+LOOKUP = """
+
+const float32_t* ifx_window_table_get_f32(ifx_window_type_t type, uint32_t len, bool periodic)
+{
+    for (uint32_t i = 0; window_tables[i].win != NULL; ++i)
+    {
+        const ifx_window_registry_entry_f32_t* entry = &window_tables[i];
+
+        if ((entry->type == type) && (entry->len == len) && (entry->periodic == periodic))
+        {
+            return entry->win;
+        }
+    }
+
+    return NULL;
+}
+"""
+
+
+def window(coeffs, length, periodic):
+    """Cosine-sum window in double precision, rounded to float32"""
+    denom = length if periodic else length - 1
+    values = []
+    for n in range(length):
+        value = sum(((-1) ** k) * a * math.cos(2.0 * math.pi * k * n / denom)
+                    for k, a in enumerate(coeffs))
+        values.append(struct.unpack("f", struct.pack("f", value))[0])
+    return values
+
+
+def parse(spec):
+    """Parse TYPE:LEN[:periodic]"""
+    fields = spec.lower().split(":")
+    if (len(fields) not in (2, 3) or fields[0] not in WINDOWS or
+            (len(fields) == 3 and fields[2] != "periodic")):
+        raise argparse.ArgumentTypeError(f"invalid window '{spec}'")
+    length = int(fields[1])
+    periodic = len(fields) == 3
+    if length < (1 if periodic else 2) or length > 65535:
+        raise argparse.ArgumentTypeError(f"invalid length in '{spec}'")
+    return fields[0], length, periodic
+
+
+def generate(windows):
+    """Return the C source for the given list of (name, length, periodic)"""
+    out = [HEADER.rstrip("\n")]
+    entries = []
+
+    for name, length, periodic in windows:
+        enum, coeffs = WINDOWS[name]
+        suffix = "_PERIODIC" if periodic else ""
+        macro = f"IFX_WINDOW_TABLE_{name.upper()}_{length}{suffix}"
+        symbol = f"{name}_{length}{suffix.lower()}"
+
+        out.append(f"\n#if defined(IFX_WINDOW_ALL_TABLES) || defined({macro})")
+        out.append(f"/** {'Periodic' if periodic else 'Symmetric'} {name} window of length "
+                   f"{length} */")
+        out.append(f"static const float32_t {symbol}[{length}] = {{")
+        values = [f"{v:.9e}F" for v in window(coeffs, length, periodic)]
+        for i in range(0, length, 4):
+            out.append("    " + ", ".join(values[i:i + 4]) + ",")
+        out.append("};")
+        out.append("#endif")
+
+        entries.append(f"#if defined(IFX_WINDOW_ALL_TABLES) || defined({macro})\n"
+                       f"    {{{enum}, {length}U, {'true' if periodic else 'false'}, "
+                       f"{symbol}}},\n"
+                       "#endif")
+
+    out.append("\n/** Generated windows, terminated by an entry without window */")
+    out.append("static const ifx_window_registry_entry_f32_t window_tables[] = {")
+    out.extend(entries)
+    out.append("    {IFX_WINDOW_HANN, 0U, false, NULL}")
+    out.append("};")
+    out.append(LOOKUP)
+
+    return "\n".join(out)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("windows", nargs="*", type=parse,
+                        help="windows as TYPE:LEN or TYPE:LEN:periodic, default "
+                             + " ".join(DEFAULT_WINDOWS))
+    parser.add_argument("-o", "--output",
+                        default=os.path.join(root, "source", "ifx_window_tables_f32.c"),
+                        help="output file")
+    args = parser.parse_args()
+
+    windows = args.windows if args.windows else [parse(w) for w in DEFAULT_WINDOWS]
+
+    with open(args.output, "w", encoding="ascii", newline="\n") as f:
+        f.write(generate(windows))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,329 @@
+/***************************************************************************//**
+* \file ifx_cfft_transform_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_fft_plan_buffer_size_f32, ifx_fft_plan_init_buffer_f32 and ifx_cfft_transform_f32
+* functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+/** Largest power of two FFT length supported by arm_cfft_f32, bounds the Bluestein length */
+#define CFFT_MAX_LEN (4096U)
+
+/** Smallest power of two FFT length used for the Bluestein convolution */
+#define CFFT_MIN_LEN (16U)
+
+/** @brief Radix of the next mixed radix stage for a remaining length n, 0 if n has a prime
+ * factor other than 2, 3 and 5 */
+static uint32_t next_radix(uint32_t n)
+{
+    uint32_t radix = 0U;
+
+    if ((n % 4U) == 0U)
+    {
+        radix = 4U;
+    }
+    else if ((n % 2U) == 0U)
+    {
+        radix = 2U;
+    }
+    else if ((n % 3U) == 0U)
+    {
+        radix = 3U;
+    }
+    else if ((n % 5U) == 0U)
+    {
+        radix = 5U;
+    }
+    else
+    {
+        //added empty else because of MISRA C-2012 15.7
+    }
+
+    return radix;
+}
+
+
+/** @brief True if fft_len only has the prime factors 2, 3 and 5 */
+static bool is_mixed_radix(uint32_t fft_len)
+{
+    uint32_t n = fft_len;
+
+    while (n > 1U)
+    {
+        const uint32_t radix = next_radix(n);
+        if (radix == 0U)
+        {
+            return false;
+        }
+        n /= radix;
+    }
+
+    return true;
+}
+
+
+/** @brief Power of two length of the Bluestein convolution, at least 2 * fft_len - 1 */
+static uint32_t bluestein_len(uint32_t fft_len)
+{
+    uint32_t len = CFFT_MIN_LEN;
+
+    while (len < ((2U * fft_len) - 1U))
+    {
+        len *= 2U;
+    }
+
+    return len;
+}
+
+
+/** @brief True if arm_cfft_init_f32 supports fft_len */
+static bool is_cmsis_len(uint16_t fft_len)
+{
+    arm_cfft_instance_f32 cfft;
+
+    return arm_cfft_init_f32(&cfft, fft_len) == ARM_MATH_SUCCESS;
+}
+
+
+/** @brief Mixed radix FFT using the Stockham autosort algorithm
+ *
+ * Each stage of radix p reads x and writes y with stride s, the buffers are swapped after every
+ * stage, so the output is in natural order without bit reversal. The buffer holds the fft_len
+ * twiddle factors exp(-2 pi i t / fft_len) followed by fft_len complex values of work memory.
+ */
+static void mixed_radix_cfft(const ifx_fft_plan_f32_t* plan, cfloat32_t* data)
+{
+    const uint32_t fft_len = plan->fft_len;
+    const float32_t* twiddle = plan->buffer;
+    float32_t* x = (float32_t*)data;
+    float32_t* y = &plan->buffer[2U * fft_len];
+    uint32_t n = fft_len;
+    uint32_t s = 1U;
+
+    while (n > 1U)
+    {
+        const uint32_t radix = next_radix(n);
+        const uint32_t m = n / radix;
+        const uint32_t radix_step = fft_len / radix;
+
+        for (uint32_t q = 0; q < m; ++q)
+        {
+            for (uint32_t j = 0; j < s; ++j)
+            {
+                for (uint32_t k = 0; k < radix; ++k)
+                {
+                    /* Radix point DFT of the inputs spaced by m * s */
+                    float32_t sumR = x[2U * (j + (s * q))];
+                    float32_t sumI = x[(2U * (j + (s * q))) + 1U];
+
+                    for (uint32_t r = 1U; r < radix; ++r)
+                    {
+                        const uint32_t idx = j + (s * (q + (m * r)));
+                        const uint32_t t = ((r * k) % radix) * radix_step;
+                        const float32_t aR = x[2U * idx];
+                        const float32_t aI = x[(2U * idx) + 1U];
+                        const float32_t wR = twiddle[2U * t];
+                        const float32_t wI = twiddle[(2U * t) + 1U];
+
+                        sumR += (aR * wR) - (aI * wI);
+                        sumI += (aR * wI) + (aI * wR);
+                    }
+
+                    const uint32_t t = q * k * s;
+                    const float32_t wR = twiddle[2U * t];
+                    const float32_t wI = twiddle[(2U * t) + 1U];
+                    const uint32_t out = j + (s * ((radix * q) + k));
+
+                    y[2U * out] = (sumR * wR) - (sumI * wI);
+                    y[(2U * out) + 1U] = (sumR * wI) + (sumI * wR);
+                }
+            }
+        }
+
+        float32_t* temp = x;
+        x = y;
+        y = temp;
+        n = m;
+        s *= radix;
+    }
+
+    if (x != (float32_t*)data)
+    {
+        arm_copy_f32(x, (float32_t*)data, 2U * fft_len);
+    }
+}
+
+
+/** @brief Bluestein FFT as convolution with a chirp, using power of two FFTs
+ *
+ * X[k] = c[k] * sum_n (x[n] * c[n]) * conj(c[k - n]) with c[n] = exp(-pi i n^2 / fft_len).
+ * The buffer holds the chirp c of fft_len complex values, the FFT of the conjugated chirp of
+ * bluestein_len complex values and bluestein_len complex values of work memory.
+ */
+static void bluestein_cfft(const ifx_fft_plan_f32_t* plan, cfloat32_t* data)
+{
+    const uint32_t fft_len = plan->fft_len;
+    const uint32_t conv_len = plan->bluestein_len;
+    const float32_t* chirp = plan->buffer;
+    const float32_t* chirp_fft = &plan->buffer[2U * fft_len];
+    float32_t* work = &plan->buffer[2U * (fft_len + conv_len)];
+
+    arm_cmplx_mult_cmplx_f32((const float32_t*)data, chirp, work, fft_len);
+    arm_fill_f32(0.0f, &work[2U * fft_len], 2U * (conv_len - fft_len));
+
+    arm_cfft_f32(&plan->cfft, work, 0, 1);
+    arm_cmplx_mult_cmplx_f32(work, chirp_fft, work, conv_len);
+    arm_cfft_f32(&plan->cfft, work, 1, 1);
+
+    arm_cmplx_mult_cmplx_f32(work, chirp, (float32_t*)data, fft_len);
+}
+
+
+uint32_t ifx_fft_plan_buffer_size_f32(ifx_fft_type_t type, uint16_t fft_len)
+{
+    uint32_t size = 0U;
+
+    if ((type != IFX_FFT_TYPE_COMPLEX) || (fft_len == 0U) || is_cmsis_len(fft_len))
+    {
+        size = 0U;
+    }
+    else if (is_mixed_radix(fft_len))
+    {
+        size = 4U * (uint32_t)fft_len;
+    }
+    else if (bluestein_len(fft_len) <= CFFT_MAX_LEN)
+    {
+        size = 2U * ((uint32_t)fft_len + (2U * bluestein_len(fft_len)));
+    }
+    else
+    {
+        //added empty else because of MISRA C-2012 15.7
+    }
+
+    return size;
+}
+
+
+int32_t ifx_fft_plan_init_buffer_f32(ifx_fft_plan_f32_t* plan,
+                                     ifx_fft_type_t type,
+                                     uint16_t fft_len,
+                                     bool mean_removal,
+                                     const float32_t* win,
+                                     float32_t* buffer,
+                                     uint32_t buffer_len)
+{
+    assert(plan != NULL);
+
+    if ((type != IFX_FFT_TYPE_COMPLEX) || (fft_len == 0U) || is_cmsis_len(fft_len))
+    {
+        return ifx_fft_plan_init_f32(plan, type, fft_len, mean_removal, win);
+    }
+
+    const uint32_t size = ifx_fft_plan_buffer_size_f32(type, fft_len);
+
+    if ((size == 0U) || (buffer == NULL) || (buffer_len < size))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    (void)memset(plan, 0, sizeof(ifx_fft_plan_f32_t));
+
+    if (is_mixed_radix(fft_len))
+    {
+        for (uint32_t t = 0; t < fft_len; ++t)
+        {
+            const float32_t phase = -2.0F * PI * (float32_t)t / (float32_t)fft_len;
+            buffer[2U * t] = arm_cos_f32(phase);
+            buffer[(2U * t) + 1U] = arm_sin_f32(phase);
+        }
+    }
+    else
+    {
+        const uint32_t conv_len = bluestein_len(fft_len);
+        float32_t* chirp_fft = &buffer[2U * fft_len];
+
+        if (arm_cfft_init_f32(&plan->cfft, (uint16_t)conv_len) != ARM_MATH_SUCCESS)
+        {
+            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+        }
+
+        arm_fill_f32(0.0f, chirp_fft, 2U * conv_len);
+
+        for (uint32_t n = 0; n < fft_len; ++n)
+        {
+            /* n^2 modulo 2 * fft_len keeps the phase argument small */
+            const uint32_t n2 = (n * n) % (2U * fft_len);
+            const float32_t phase = PI * (float32_t)n2 / (float32_t)fft_len;
+            const float32_t c = arm_cos_f32(phase);
+            const float32_t s = arm_sin_f32(phase);
+
+            buffer[2U * n] = c;
+            buffer[(2U * n) + 1U] = -s;
+
+            chirp_fft[2U * n] = c;
+            chirp_fft[(2U * n) + 1U] = s;
+            if (n > 0U)
+            {
+                chirp_fft[2U * (conv_len - n)] = c;
+                chirp_fft[(2U * (conv_len - n)) + 1U] = s;
+            }
+        }
+
+        arm_cfft_f32(&plan->cfft, chirp_fft, 0, 1);
+
+        plan->bluestein_len = (uint16_t)conv_len;
+    }
+
+    plan->type = type;
+    plan->fft_len = fft_len;
+    plan->mean_removal = mean_removal;
+    plan->win = win;
+    plan->num_samples = fft_len;
+    plan->first_bin = 0U;
+    plan->num_bins = fft_len;
+    plan->buffer = buffer;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+void ifx_cfft_transform_f32(const ifx_fft_plan_f32_t* plan, cfloat32_t* data)
+{
+    assert(plan != NULL);
+    assert(data != NULL);
+
+    if (plan->buffer == NULL)
+    {
+        arm_cfft_f32(&plan->cfft, (float32_t*)data, 0, 1);
+    }
+    else if (plan->bluestein_len == 0U)
+    {
+        mixed_radix_cfft(plan, data);
+    }
+    else
+    {
+        bluestein_cfft(plan, data);
+    }
+}
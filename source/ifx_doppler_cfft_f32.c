@@ -3,7 +3,8 @@
 *
 * \brief
 * This file contains the implementation for the
-* ifx_doppler_cfft_f32 function
+* ifx_doppler_cfft_transform_f32, ifx_doppler_cfft_exec_f32, ifx_doppler_cfft_map_f32,
+* ifx_doppler_cfft_integrate_f32 and ifx_doppler_cfft_f32 functions
 *
 *******************************************************************************
 * \copyright
@@ -25,59 +26,252 @@
 
 #include "ifx_sensor_dsp.h"
 
-int32_t ifx_doppler_cfft_f32(cfloat32_t* range,
-                             cfloat32_t* doppler,
-                             bool mean_removal,
-                             const float32_t* win,
-                             uint16_t num_range_bins,
-                             uint16_t num_chirps_per_frame)
+/** @brief Gather the slow time columns of num_tile_bins range bins into their doppler rows */
+static void gather_tile(const cfloat32_t* range,
+                        cfloat32_t* doppler,
+                        uint32_t num_tile_bins,
+                        uint32_t num_range_bins,
+                        uint32_t num_chirps_per_frame)
 {
+    for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    {
+        const cfloat32_t* pIn = &range[chirp_idx * num_range_bins];
+        cfloat32_t* pOut = &doppler[chirp_idx];
+
+        for (uint32_t bin_idx = 0; bin_idx < num_tile_bins; ++bin_idx)
+        {
+            *pOut = pIn[bin_idx];
+            pOut += num_chirps_per_frame;
+        }
+    }
+}
+
+
+void ifx_doppler_cfft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                    cfloat32_t* samples)
+{
+    assert(plan != NULL);
+    assert(samples != NULL);
+
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    if (plan->cwin != NULL)
+    {
+        ifx_cmplx_window_composite_apply_f32(samples, samples, plan->cwin, plan->mean_removal,
+                                             num_chirps_per_frame);
+    }
+    else if (plan->win_half)
+    {
+        ifx_cmplx_window_half_apply_f32(samples, samples, plan->win, plan->mean_removal,
+                                        num_chirps_per_frame);
+    }
+    else if (plan->mean_removal)
+    {
+        ifx_cmplx_mean_removal_window_f32(samples, samples, plan->win, num_chirps_per_frame);
+    }
+    else if (plan->win != NULL)
+    {
+        arm_cmplx_mult_real_f32((float32_t*)samples,
+                                plan->win,
+                                (float32_t*)samples,
+                                num_chirps_per_frame);
+    }
+    else
+    {
+        //added empty else because of MISRA C-2012 15.7
+    }
+
+    if (plan->fft_shift)
+    {
+        /* Modulation by (-1)^n moves the spectrum by fft_len/2 bins */
+        for (uint32_t n = 1U; n < num_chirps_per_frame; n += 2U)
+        {
+            samples[n] = -samples[n];
+        }
+    }
+
+    ifx_cfft_transform_f32(plan, samples);
+}
+
+
+int32_t ifx_doppler_cfft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                                  cfloat32_t* range,
+                                  cfloat32_t* doppler,
+                                  uint16_t num_range_bins)
+{
+    assert(plan != NULL);
     assert(range != NULL);
     assert(doppler != NULL);
 
-    static arm_cfft_instance_f32 cfft = { 0 };
-    if (cfft.fftLen != num_chirps_per_frame)
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
     {
-        if (arm_cfft_init_f32(&cfft, num_chirps_per_frame) != ARM_MATH_SUCCESS)
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    for (uint32_t tile_idx = 0; tile_idx < num_range_bins; tile_idx += IFX_DOPPLER_TILE_BINS)
+    {
+        const uint32_t num_tile_bins = ((num_range_bins - tile_idx) < IFX_DOPPLER_TILE_BINS) ?
+                                       (num_range_bins - tile_idx) : IFX_DOPPLER_TILE_BINS;
+
+        gather_tile(&range[tile_idx], doppler, num_tile_bins, num_range_bins,
+                    num_chirps_per_frame);
+
+        for (uint32_t bin_idx = 0; bin_idx < num_tile_bins; ++bin_idx)
         {
-            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+            ifx_doppler_cfft_transform_f32(plan, doppler);
+
+            doppler += num_chirps_per_frame;
         }
     }
 
-    arm_matrix_instance_f32 range_matrix =
-    {
-        num_chirps_per_frame,
-        num_range_bins,
-        (float32_t*)range
-    };
-    arm_matrix_instance_f32 doppler_matrix =
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_doppler_cfft_map_f32(const ifx_fft_plan_f32_t* plan,
+                                 const cfloat32_t* range,
+                                 float32_t* map,
+                                 uint16_t num_range_bins,
+                                 ifx_doppler_output_t output,
+                                 cfloat32_t* scratch)
+{
+    assert(plan != NULL);
+    assert(range != NULL);
+    assert(map != NULL);
+    assert(scratch != NULL);
+
+    if ((plan->type != IFX_FFT_TYPE_COMPLEX) || (output == IFX_DOPPLER_OUTPUT_COMPLEX))
     {
-        num_range_bins,
-        num_chirps_per_frame,
-        (float32_t*)doppler
-    };
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
 
-    (void)arm_mat_cmplx_trans_f32(&range_matrix, &doppler_matrix);
+    const uint16_t num_chirps_per_frame = plan->fft_len;
 
-    for (uint32_t range_idx = 0; range_idx < num_range_bins; ++range_idx)
+    for (uint32_t tile_idx = 0; tile_idx < num_range_bins; tile_idx += IFX_DOPPLER_TILE_BINS)
     {
-        if (mean_removal)
+        const uint32_t num_tile_bins = ((num_range_bins - tile_idx) < IFX_DOPPLER_TILE_BINS) ?
+                                       (num_range_bins - tile_idx) : IFX_DOPPLER_TILE_BINS;
+
+        gather_tile(&range[tile_idx], scratch, num_tile_bins, num_range_bins,
+                    num_chirps_per_frame);
+
+        cfloat32_t* doppler = scratch;
+        for (uint32_t bin_idx = 0; bin_idx < num_tile_bins; ++bin_idx)
         {
-            ifx_cmplx_mean_removal_f32(doppler, num_chirps_per_frame);
+            ifx_doppler_cfft_transform_f32(plan, doppler);
+
+            if (output == IFX_DOPPLER_OUTPUT_MAGNITUDE)
+            {
+                arm_cmplx_mag_f32((const float32_t*)doppler, map, num_chirps_per_frame);
+            }
+            else
+            {
+                arm_cmplx_mag_squared_f32((const float32_t*)doppler, map, num_chirps_per_frame);
+            }
+
+            if (output == IFX_DOPPLER_OUTPUT_POWER_DB)
+            {
+                /* 10 * log10(x) = 10 / ln(10) * ln(x) */
+                arm_vlog_f32(map, map, num_chirps_per_frame);
+                arm_scale_f32(map, 4.342944819F, map, num_chirps_per_frame);
+            }
+
+            doppler += num_chirps_per_frame;
+            map += num_chirps_per_frame;
         }
+    }
 
-        if (win != NULL)
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_doppler_cfft_integrate_f32(const ifx_fft_plan_f32_t* plan,
+                                       const cfloat32_t* range,
+                                       uint16_t num_range_bins,
+                                       float32_t* map,
+                                       const uint16_t* range_bins,
+                                       uint16_t num_selected_bins,
+                                       cfloat32_t* selected,
+                                       cfloat32_t* scratch)
+{
+    assert(plan != NULL);
+    assert(range != NULL);
+    assert(map != NULL);
+    assert(scratch != NULL);
+    assert((num_selected_bins == 0U) || ((range_bins != NULL) && (selected != NULL)));
+
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t i = 0; i < num_selected_bins; ++i)
+    {
+        if (range_bins[i] >= num_range_bins)
         {
-            arm_cmplx_mult_real_f32((float32_t*)doppler,
-                                    win,
-                                    (float32_t*)doppler,
-                                    num_chirps_per_frame);
+            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
         }
+    }
 
-        arm_cfft_f32(&cfft, (float32_t*)doppler, 0, 1);
+    const uint16_t num_chirps_per_frame = plan->fft_len;
 
-        doppler += num_chirps_per_frame;
+    for (uint32_t tile_idx = 0; tile_idx < num_range_bins; tile_idx += IFX_DOPPLER_TILE_BINS)
+    {
+        const uint32_t num_tile_bins = ((num_range_bins - tile_idx) < IFX_DOPPLER_TILE_BINS) ?
+                                       (num_range_bins - tile_idx) : IFX_DOPPLER_TILE_BINS;
+
+        gather_tile(&range[tile_idx], scratch, num_tile_bins, num_range_bins,
+                    num_chirps_per_frame);
+
+        cfloat32_t* spectrum = scratch;
+        for (uint32_t bin_idx = 0; bin_idx < num_tile_bins; ++bin_idx)
+        {
+            ifx_doppler_cfft_transform_f32(plan, spectrum);
+
+            const float32_t* pIn = (const float32_t*)spectrum;
+
+            for (uint32_t i = 0; i < num_selected_bins; ++i)
+            {
+                if (range_bins[i] == (tile_idx + bin_idx))
+                {
+                    arm_copy_f32(pIn, (float32_t*)&selected[i * num_chirps_per_frame],
+                                 2U * num_chirps_per_frame);
+                }
+            }
+
+            for (uint32_t n = 0; n < num_chirps_per_frame; ++n)
+            {
+                map[n] += (pIn[2U * n] * pIn[2U * n]) + (pIn[(2U * n) + 1U] * pIn[(2U * n) + 1U]);
+            }
+
+            spectrum += num_chirps_per_frame;
+            map += num_chirps_per_frame;
+        }
     }
 
     return IFX_SENSOR_DSP_STATUS_OK;
 }
+
+
+int32_t ifx_doppler_cfft_f32(cfloat32_t* range,
+                             cfloat32_t* doppler,
+                             bool mean_removal,
+                             const float32_t* win,
+                             uint16_t num_range_bins,
+                             uint16_t num_chirps_per_frame)
+{
+    assert(range != NULL);
+    assert(doppler != NULL);
+
+    ifx_fft_plan_f32_t plan;
+    int32_t status = ifx_fft_plan_init_f32(&plan, IFX_FFT_TYPE_COMPLEX, num_chirps_per_frame,
+                                           mean_removal, win);
+    if (status == IFX_SENSOR_DSP_STATUS_OK)
+    {
+        status = ifx_doppler_cfft_exec_f32(&plan, range, doppler, num_range_bins);
+    }
+
+    return status;
+}
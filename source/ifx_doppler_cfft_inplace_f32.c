@@ -0,0 +1,164 @@
+/***************************************************************************//**
+* \file ifx_doppler_cfft_inplace_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_doppler_cfft_inplace_f32 and ifx_doppler_cfft_columns_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+/** @brief Transpose a complex matrix of shape [rows][cols] in-place by following the
+ * permutation cycles
+ *
+ * Element i = r * cols + c moves to c * rows + r = (i * rows) mod (rows * cols - 1). Each cycle
+ * is moved once, starting from its smallest index. The indices are scanned in windows of
+ * IFX_DOPPLER_INPLACE_BITMAP_BITS, a bitmap marks the indices of the window whose cycle has
+ * already been walked, so each cycle is walked at most once per window it intersects.
+ */
+static void cmplx_transpose_inplace(cfloat32_t* data, uint32_t rows, uint32_t cols)
+{
+    if ((rows <= 1U) || (cols <= 1U))
+    {
+        /* An empty matrix, a single row or a single column keeps its memory layout */
+        return;
+    }
+
+    const uint32_t last = (rows * cols) - 1U;
+    const uint32_t num_inner = last - 1U;
+    uint32_t visited[IFX_DOPPLER_INPLACE_BITMAP_BITS / 32U];
+    uint32_t num_moved = 0U;
+    uint32_t base = 1U;
+
+    while ((base < last) && (num_moved < num_inner))
+    {
+        const uint32_t end = ((last - base) < IFX_DOPPLER_INPLACE_BITMAP_BITS) ?
+                             last : (base + IFX_DOPPLER_INPLACE_BITMAP_BITS);
+
+        (void)memset(visited, 0, sizeof(visited));
+
+        for (uint32_t start = base; (start < end) && (num_moved < num_inner); ++start)
+        {
+            uint32_t offset = start - base;
+
+            if ((visited[offset / 32U] & (1UL << (offset % 32U))) != 0U)
+            {
+                continue;
+            }
+
+            /* Walk the cycle until an index not larger than start, start leads the cycle only
+             * if it is reached again */
+            uint32_t next = start;
+            do
+            {
+                next = (uint32_t)(((uint64_t)next * rows) % last);
+                if ((next > start) && (next < end))
+                {
+                    offset = next - base;
+                    visited[offset / 32U] |= 1UL << (offset % 32U);
+                }
+            } while (next > start);
+
+            if (next == start)
+            {
+                cfloat32_t value = data[start];
+                uint32_t idx = start;
+
+                do
+                {
+                    next = (uint32_t)(((uint64_t)idx * rows) % last);
+                    const cfloat32_t tmp = data[next];
+                    data[next] = value;
+                    value = tmp;
+                    idx = next;
+                    ++num_moved;
+                } while (idx != start);
+            }
+        }
+
+        base = end;
+    }
+}
+
+
+int32_t ifx_doppler_cfft_inplace_f32(const ifx_fft_plan_f32_t* plan,
+                                     cfloat32_t* range,
+                                     uint16_t num_range_bins)
+{
+    assert(plan != NULL);
+    assert(range != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    cmplx_transpose_inplace(range, num_chirps_per_frame, num_range_bins);
+
+    for (uint32_t range_idx = 0; range_idx < num_range_bins; ++range_idx)
+    {
+        ifx_doppler_cfft_transform_f32(plan, range);
+
+        range += num_chirps_per_frame;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_doppler_cfft_columns_f32(const ifx_fft_plan_f32_t* plan,
+                                     cfloat32_t* range,
+                                     cfloat32_t* scratch,
+                                     uint16_t num_range_bins)
+{
+    assert(plan != NULL);
+    assert(range != NULL);
+    assert(scratch != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    for (uint32_t range_idx = 0; range_idx < num_range_bins; ++range_idx)
+    {
+        cfloat32_t* column = &range[range_idx];
+
+        for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+        {
+            scratch[chirp_idx] = column[chirp_idx * num_range_bins];
+        }
+
+        ifx_doppler_cfft_transform_f32(plan, scratch);
+
+        for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+        {
+            column[chirp_idx * num_range_bins] = scratch[chirp_idx];
+        }
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
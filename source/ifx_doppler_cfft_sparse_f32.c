@@ -0,0 +1,70 @@
+/***************************************************************************//**
+* \file ifx_doppler_cfft_sparse_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_doppler_cfft_sparse_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+int32_t ifx_doppler_cfft_sparse_f32(const ifx_fft_plan_f32_t* plan,
+                                    const cfloat32_t* range,
+                                    uint16_t num_range_bins,
+                                    const uint16_t* range_bins,
+                                    uint16_t num_selected_bins,
+                                    cfloat32_t* doppler)
+{
+    assert(plan != NULL);
+    assert(range != NULL);
+    assert(range_bins != NULL);
+    assert(doppler != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    for (uint32_t i = 0; i < num_selected_bins; ++i)
+    {
+        if (range_bins[i] >= num_range_bins)
+        {
+            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+        }
+    }
+
+    const uint16_t num_chirps_per_frame = plan->fft_len;
+
+    for (uint32_t i = 0; i < num_selected_bins; ++i)
+    {
+        const cfloat32_t* column = &range[range_bins[i]];
+
+        for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+        {
+            doppler[chirp_idx] = column[chirp_idx * num_range_bins];
+        }
+
+        ifx_doppler_cfft_transform_f32(plan, doppler);
+
+        doppler += num_chirps_per_frame;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
@@ -0,0 +1,103 @@
+/***************************************************************************//**
+* \file ifx_fft_plan_cache_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_fft_plan_cache_init_f32 and ifx_fft_plan_cache_get_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_fft_plan_cache_init_f32(ifx_fft_plan_cache_f32_t* cache)
+{
+    assert(cache != NULL);
+
+    (void)memset(cache, 0, sizeof(ifx_fft_plan_cache_f32_t));
+}
+
+
+int32_t ifx_fft_plan_cache_get_f32(ifx_fft_plan_cache_f32_t* cache,
+                                   ifx_fft_type_t type,
+                                   uint16_t fft_len,
+                                   bool mean_removal,
+                                   const float32_t* win,
+                                   ifx_fft_plan_f32_t* plan)
+{
+    assert(cache != NULL);
+    assert(plan != NULL);
+
+    const uint32_t lookup = cache->hits + cache->misses + 1U;
+    uint32_t idx = 0U;
+
+    while (idx < cache->num_plans)
+    {
+        if ((cache->plans[idx].type == type) && (cache->plans[idx].fft_len == fft_len))
+        {
+            break;
+        }
+        ++idx;
+    }
+
+    if (idx < cache->num_plans)
+    {
+        cache->hits++;
+    }
+    else
+    {
+        ifx_fft_plan_f32_t new_plan;
+        if (ifx_fft_plan_init_f32(&new_plan, type, fft_len, false, NULL) !=
+            IFX_SENSOR_DSP_STATUS_OK)
+        {
+            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+        }
+
+        if (cache->num_plans < IFX_FFT_PLAN_CACHE_SIZE)
+        {
+            idx = cache->num_plans;
+            cache->num_plans++;
+        }
+        else
+        {
+            /* Replace the least recently used plan */
+            idx = 0U;
+            for (uint32_t i = 1U; i < IFX_FFT_PLAN_CACHE_SIZE; ++i)
+            {
+                if (cache->last_used[i] < cache->last_used[idx])
+                {
+                    idx = i;
+                }
+            }
+        }
+
+        cache->plans[idx] = new_plan;
+        cache->misses++;
+    }
+
+    cache->last_used[idx] = lookup;
+
+    /* The cached plan keeps its default settings, the caller gets its own copy */
+    *plan = cache->plans[idx];
+    plan->mean_removal = mean_removal;
+    plan->win = win;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
@@ -0,0 +1,154 @@
+/***************************************************************************//**
+* \file ifx_fft_plan_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_fft_plan_init_f32, ifx_fft_plan_set_zero_padding_f32,
+* ifx_fft_plan_set_range_gate_f32 and ifx_fft_plan_destroy_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+int32_t ifx_fft_plan_init_f32(ifx_fft_plan_f32_t* plan,
+                              ifx_fft_type_t type,
+                              uint16_t fft_len,
+                              bool mean_removal,
+                              const float32_t* win)
+{
+    assert(plan != NULL);
+
+    (void)memset(plan, 0, sizeof(ifx_fft_plan_f32_t));
+
+    arm_status status;
+    if (type == IFX_FFT_TYPE_REAL)
+    {
+        status = arm_rfft_fast_init_f32(&plan->rfft, fft_len);
+    }
+    else if ((type == IFX_FFT_TYPE_COMPLEX) || (type == IFX_FFT_TYPE_REAL_PAIR))
+    {
+        status = arm_cfft_init_f32(&plan->cfft, fft_len);
+    }
+    else
+    {
+        status = ARM_MATH_ARGUMENT_ERROR;
+    }
+
+    if (status != ARM_MATH_SUCCESS)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    plan->type = type;
+    plan->fft_len = fft_len;
+    plan->mean_removal = mean_removal;
+    plan->win = win;
+    plan->num_samples = fft_len;
+    plan->first_bin = 0U;
+    plan->num_bins = (type == IFX_FFT_TYPE_COMPLEX) ? fft_len : (fft_len / 2U);
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_fft_plan_set_zero_padding_f32(ifx_fft_plan_f32_t* plan, uint16_t factor)
+{
+    assert(plan != NULL);
+
+    if ((factor == 0U) || ((plan->fft_len % factor) != 0U))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    plan->num_samples = plan->fft_len / factor;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_fft_plan_set_range_gate_f32(ifx_fft_plan_f32_t* plan,
+                                        uint16_t first_bin,
+                                        uint16_t num_bins)
+{
+    assert(plan != NULL);
+
+    const uint32_t max_bins = (plan->type == IFX_FFT_TYPE_COMPLEX) ?
+                              plan->fft_len : (plan->fft_len / 2U);
+
+    if ((num_bins == 0U) || (((uint32_t)first_bin + num_bins) > max_bins))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    plan->first_bin = first_bin;
+    plan->num_bins = num_bins;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_fft_plan_set_fft_shift_f32(ifx_fft_plan_f32_t* plan, bool fft_shift)
+{
+    assert(plan != NULL);
+
+    /* The (-1)^n modulation only moves the spectrum by whole bins for even lengths */
+    if ((plan->type != IFX_FFT_TYPE_COMPLEX) || ((plan->fft_len % 2U) != 0U))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    plan->fft_shift = fft_shift;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+void ifx_fft_plan_set_half_window_f32(ifx_fft_plan_f32_t* plan, const float32_t* half)
+{
+    assert(plan != NULL);
+    assert(half != NULL);
+
+    plan->win = half;
+    plan->win_half = true;
+}
+
+
+int32_t ifx_fft_plan_set_complex_window_f32(ifx_fft_plan_f32_t* plan, const cfloat32_t* cwin)
+{
+    assert(plan != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_COMPLEX)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    plan->cwin = cwin;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+void ifx_fft_plan_destroy_f32(ifx_fft_plan_f32_t* plan)
+{
+    assert(plan != NULL);
+
+    (void)memset(plan, 0, sizeof(ifx_fft_plan_f32_t));
+}
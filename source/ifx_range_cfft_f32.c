@@ -3,7 +3,7 @@
 *
 * \brief
 * This file contains the implementation for the
-* ifx_range_cfft_f32 function
+* ifx_range_cfft_exec_f32, ifx_range_cfft_oop_f32 and ifx_range_cfft_f32 functions
 *
 *******************************************************************************
 * \copyright
@@ -25,40 +25,132 @@
 
 #include "ifx_sensor_dsp.h"
 
-int32_t ifx_range_cfft_f32(cfloat32_t* frame,
-                           bool mean_removal,
-                           const float32_t* win,
-                           uint16_t num_samples_per_chirp,
-                           uint16_t num_chirps_per_frame)
+/** @brief Calculate range FFT of one chirp
+ *
+ * Mean removal and windowing read src and write into work, followed by zero padding up to the
+ * FFT length, then work is transformed in-place. src and work can be equal. The range gate bins
+ * are moved to range, which can overlap with work if it is not behind work.
+ */
+static void range_cfft_chirp(const ifx_fft_plan_f32_t* plan,
+                             const cfloat32_t* src,
+                             cfloat32_t* work,
+                             cfloat32_t* range)
 {
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    if (plan->cwin != NULL)
+    {
+        ifx_cmplx_window_composite_apply_f32(src, work, plan->cwin, plan->mean_removal,
+                                             num_samples_per_chirp);
+    }
+    else if (plan->win_half)
+    {
+        ifx_cmplx_window_half_apply_f32(src, work, plan->win, plan->mean_removal,
+                                        num_samples_per_chirp);
+    }
+    else if (plan->mean_removal)
+    {
+        ifx_cmplx_mean_removal_window_f32(src, work, plan->win, num_samples_per_chirp);
+    }
+    else if (plan->win != NULL)
+    {
+        arm_cmplx_mult_real_f32((const float32_t*)src, plan->win, (float32_t*)work,
+                                num_samples_per_chirp);
+    }
+    else if (src != work)
+    {
+        arm_copy_f32((const float32_t*)src, (float32_t*)work, 2U * num_samples_per_chirp);
+    }
+    else
+    {
+        //added empty else because of MISRA C-2012 15.7
+    }
+
+    if (num_samples_per_chirp < plan->fft_len)
+    {
+        arm_fill_f32(0.0f, (float32_t*)&work[num_samples_per_chirp],
+                     2U * (plan->fft_len - num_samples_per_chirp));
+    }
+
+    ifx_range_cfft_transform_f32(plan, work, range);
+}
+
+
+int32_t ifx_range_cfft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                                cfloat32_t* frame,
+                                uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
     assert(frame != NULL);
 
-    static arm_cfft_instance_f32 cfft = { 0 };
-    if (cfft.fftLen != num_samples_per_chirp)
+    /* Each chirp is processed in-place, zero padding does not fit into the frame */
+    if ((plan->type != IFX_FFT_TYPE_COMPLEX) || (plan->num_samples != plan->fft_len))
     {
-        if (arm_cfft_init_f32(&cfft, num_samples_per_chirp) != ARM_MATH_SUCCESS)
-        {
-            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
-        }
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
     }
 
+    const uint16_t num_samples_per_chirp = plan->fft_len;
+
+    /* With a range gate the chirps are compacted in-place, the output of a chirp never overlaps
+     * with the input of the following chirps */
+    cfloat32_t* range = frame;
+
     for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
     {
-        if (mean_removal)
-        {
-            ifx_cmplx_mean_removal_f32(frame, num_samples_per_chirp);
-        }
+        range_cfft_chirp(plan, frame, frame, range);
 
-        if (win != NULL)
-        {
-            arm_cmplx_mult_real_f32((float32_t*)frame, win, (float32_t*)frame,
-                                    num_samples_per_chirp);
-        }
+        frame += num_samples_per_chirp;
+        range += plan->num_bins;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_range_cfft_oop_f32(const ifx_fft_plan_f32_t* plan,
+                               const cfloat32_t* frame,
+                               cfloat32_t* range,
+                               uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
+    assert(frame != NULL);
+    assert(range != NULL);
+
+    /* Each chirp is transformed in its output row, which must hold the full FFT */
+    if ((plan->type != IFX_FFT_TYPE_COMPLEX) || (plan->num_bins != plan->fft_len))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
 
-        arm_cfft_f32(&cfft, (float32_t*)frame, 0, 1);
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    {
+        range_cfft_chirp(plan, frame, range, range);
 
         frame += num_samples_per_chirp;
+        range += plan->fft_len;
     }
 
     return IFX_SENSOR_DSP_STATUS_OK;
 }
+
+
+int32_t ifx_range_cfft_f32(cfloat32_t* frame,
+                           bool mean_removal,
+                           const float32_t* win,
+                           uint16_t num_samples_per_chirp,
+                           uint16_t num_chirps_per_frame)
+{
+    assert(frame != NULL);
+
+    ifx_fft_plan_f32_t plan;
+    int32_t status = ifx_fft_plan_init_f32(&plan, IFX_FFT_TYPE_COMPLEX, num_samples_per_chirp,
+                                           mean_removal, win);
+    if (status == IFX_SENSOR_DSP_STATUS_OK)
+    {
+        status = ifx_range_cfft_exec_f32(&plan, frame, num_chirps_per_frame);
+    }
+
+    return status;
+}
@@ -0,0 +1,101 @@
+/***************************************************************************//**
+* \file ifx_range_cfft_u16_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_range_cfft_u16_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+int32_t ifx_range_cfft_u16_f32(const ifx_fft_plan_f32_t* plan,
+                               const uint16_t* frame,
+                               cfloat32_t* range,
+                               float32_t offset,
+                               float32_t scale,
+                               uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
+    assert(frame != NULL);
+    assert(range != NULL);
+
+    /* Each chirp is transformed in its output row, which must hold the full FFT */
+    if ((plan->type != IFX_FFT_TYPE_COMPLEX) || (plan->num_bins != plan->fft_len))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    {
+        float32_t bias_i = offset;
+        float32_t bias_q = offset;
+        if (plan->mean_removal)
+        {
+            /* The mean replaces the offset, accumulate in integer to keep it exact */
+            uint32_t sum_i = 0U;
+            uint32_t sum_q = 0U;
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                sum_i += frame[2U * n];
+                sum_q += frame[(2U * n) + 1U];
+            }
+            bias_i = (float32_t)sum_i / (float32_t)num_samples_per_chirp;
+            bias_q = (float32_t)sum_q / (float32_t)num_samples_per_chirp;
+        }
+
+        /* Single pass converting, removing the bias, scaling and windowing */
+        float32_t* pDst = (float32_t*)range;
+        if (plan->cwin != NULL)
+        {
+            const float32_t* pWin = (const float32_t*)plan->cwin;
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                const float32_t xR = ((float32_t)frame[2U * n] - bias_i) * scale;
+                const float32_t xI = ((float32_t)frame[(2U * n) + 1U] - bias_q) * scale;
+                pDst[2U * n] = (xR * pWin[2U * n]) - (xI * pWin[(2U * n) + 1U]);
+                pDst[(2U * n) + 1U] = (xR * pWin[(2U * n) + 1U]) + (xI * pWin[2U * n]);
+            }
+        }
+        else
+        {
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                const float32_t gain = scale * ifx_fft_plan_win_f32(plan, n);
+                pDst[2U * n] = ((float32_t)frame[2U * n] - bias_i) * gain;
+                pDst[(2U * n) + 1U] = ((float32_t)frame[(2U * n) + 1U] - bias_q) * gain;
+            }
+        }
+
+        if (num_samples_per_chirp < plan->fft_len)
+        {
+            arm_fill_f32(0.0f, &pDst[2U * num_samples_per_chirp],
+                         2U * (plan->fft_len - num_samples_per_chirp));
+        }
+
+        ifx_cfft_transform_f32(plan, range);
+
+        frame += 2U * num_samples_per_chirp;
+        range += plan->fft_len;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
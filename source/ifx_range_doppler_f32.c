@@ -0,0 +1,251 @@
+/***************************************************************************//**
+* \file ifx_range_doppler_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_range_doppler_workspace_size_f32, ifx_range_doppler_init_f32 and
+* ifx_range_doppler_exec_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+/** @brief Number of range bins without range gate */
+static uint32_t max_range_bins(const ifx_range_doppler_config_f32_t* config)
+{
+    return (config->input_type == IFX_FFT_TYPE_REAL) ?
+           (config->num_samples_per_chirp / 2U) : config->num_samples_per_chirp;
+}
+
+
+/** @brief Number of range bins of the configured range gate */
+static uint32_t num_range_bins(const ifx_range_doppler_config_f32_t* config)
+{
+    uint32_t num_bins = config->num_range_bins;
+
+    if ((num_bins == 0U) && (config->first_range_bin < max_range_bins(config)))
+    {
+        num_bins = max_range_bins(config) - config->first_range_bin;
+    }
+
+    return num_bins;
+}
+
+
+/** @brief Number of float32_t elements of the range matrix in the workspace. Complex input is
+ * transformed with full fft_len rows and compacted afterwards. */
+static uint32_t range_size(const ifx_range_doppler_config_f32_t* config)
+{
+    const uint32_t row_len = (config->input_type == IFX_FFT_TYPE_REAL) ?
+                             num_range_bins(config) : config->num_samples_per_chirp;
+
+    return 2U * row_len * config->num_chirps_per_frame;
+}
+
+
+/** @brief Number of float32_t elements of the range FFT scratch in the workspace */
+static uint32_t scratch_size(const ifx_range_doppler_config_f32_t* config)
+{
+    return (config->input_type == IFX_FFT_TYPE_REAL) ? (2U * config->num_samples_per_chirp) : 0U;
+}
+
+
+/** @brief Number of float32_t elements of the Doppler tile scratch in the workspace */
+static uint32_t doppler_scratch_size(const ifx_range_doppler_config_f32_t* config)
+{
+    return (config->output != IFX_DOPPLER_OUTPUT_COMPLEX) ?
+           (2U * IFX_DOPPLER_TILE_BINS * config->num_chirps_per_frame) : 0U;
+}
+
+
+uint32_t ifx_range_doppler_workspace_size_f32(const ifx_range_doppler_config_f32_t* config)
+{
+    assert(config != NULL);
+
+    uint32_t size = range_size(config) + scratch_size(config) + doppler_scratch_size(config);
+
+    if (config->input_type == IFX_FFT_TYPE_COMPLEX)
+    {
+        size += ifx_fft_plan_buffer_size_f32(IFX_FFT_TYPE_COMPLEX,
+                                             config->num_samples_per_chirp);
+    }
+
+    size += ifx_fft_plan_buffer_size_f32(IFX_FFT_TYPE_COMPLEX, config->num_chirps_per_frame);
+
+    return size;
+}
+
+
+int32_t ifx_range_doppler_init_f32(ifx_range_doppler_f32_t* engine,
+                                   const ifx_range_doppler_config_f32_t* config,
+                                   float32_t* workspace,
+                                   uint32_t workspace_len)
+{
+    assert(engine != NULL);
+    assert(config != NULL);
+
+    if (((config->input_type != IFX_FFT_TYPE_REAL) &&
+         (config->input_type != IFX_FFT_TYPE_COMPLEX)) ||
+        (config->output > IFX_DOPPLER_OUTPUT_POWER_DB) ||
+        (workspace == NULL) || (workspace_len < ifx_range_doppler_workspace_size_f32(config)))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    /* Real input is windowed by a real window, see ifx_window_composite_f32 */
+    if ((config->input_type == IFX_FFT_TYPE_REAL) && (config->range_cwin != NULL))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    if ((num_range_bins(config) == 0U) ||
+        (((uint32_t)config->first_range_bin + num_range_bins(config)) > max_range_bins(config)))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    (void)memset(engine, 0, sizeof(ifx_range_doppler_f32_t));
+
+    float32_t* pWork = workspace;
+    engine->range = (cfloat32_t*)pWork;
+    pWork += range_size(config);
+    engine->scratch = (scratch_size(config) != 0U) ? pWork : NULL;
+    pWork += scratch_size(config);
+    engine->doppler_scratch = (doppler_scratch_size(config) != 0U) ? (cfloat32_t*)pWork : NULL;
+    pWork += doppler_scratch_size(config);
+
+    int32_t status;
+    if (config->input_type == IFX_FFT_TYPE_REAL)
+    {
+        /* Chirps are transformed pairwise by one complex FFT */
+        const ifx_fft_type_t range_type = (config->num_chirps_per_frame > 1U) ?
+                                          IFX_FFT_TYPE_REAL_PAIR : IFX_FFT_TYPE_REAL;
+        status = ifx_fft_plan_init_f32(&engine->range_plan, range_type,
+                                       config->num_samples_per_chirp,
+                                       config->range_mean_removal, config->range_win);
+        if (status == IFX_SENSOR_DSP_STATUS_OK)
+        {
+            status = ifx_fft_plan_set_range_gate_f32(&engine->range_plan,
+                                                     config->first_range_bin,
+                                                     (uint16_t)num_range_bins(config));
+        }
+    }
+    else
+    {
+        const uint32_t buffer_len = ifx_fft_plan_buffer_size_f32(IFX_FFT_TYPE_COMPLEX,
+                                                                 config->num_samples_per_chirp);
+        status = ifx_fft_plan_init_buffer_f32(&engine->range_plan, IFX_FFT_TYPE_COMPLEX,
+                                              config->num_samples_per_chirp,
+                                              config->range_mean_removal, config->range_win,
+                                              pWork, buffer_len);
+        pWork += buffer_len;
+
+        if ((status == IFX_SENSOR_DSP_STATUS_OK) && (config->range_cwin != NULL))
+        {
+            status = ifx_fft_plan_set_complex_window_f32(&engine->range_plan,
+                                                         config->range_cwin);
+        }
+    }
+
+    if (status == IFX_SENSOR_DSP_STATUS_OK)
+    {
+        const uint32_t buffer_len = ifx_fft_plan_buffer_size_f32(IFX_FFT_TYPE_COMPLEX,
+                                                                 config->num_chirps_per_frame);
+        status = ifx_fft_plan_init_buffer_f32(&engine->doppler_plan, IFX_FFT_TYPE_COMPLEX,
+                                              config->num_chirps_per_frame,
+                                              config->doppler_mean_removal, config->doppler_win,
+                                              pWork, buffer_len);
+    }
+
+    if ((status == IFX_SENSOR_DSP_STATUS_OK) && (config->doppler_cwin != NULL))
+    {
+        status = ifx_fft_plan_set_complex_window_f32(&engine->doppler_plan, config->doppler_cwin);
+    }
+
+    if ((status == IFX_SENSOR_DSP_STATUS_OK) && config->fft_shift)
+    {
+        status = ifx_fft_plan_set_fft_shift_f32(&engine->doppler_plan, true);
+    }
+
+    if (status == IFX_SENSOR_DSP_STATUS_OK)
+    {
+        engine->config = *config;
+        engine->config.num_range_bins = (uint16_t)num_range_bins(config);
+    }
+
+    return status;
+}
+
+
+int32_t ifx_range_doppler_exec_f32(const ifx_range_doppler_f32_t* engine,
+                                   const float32_t* frame,
+                                   void* rd_map)
+{
+    assert(engine != NULL);
+    assert(frame != NULL);
+    assert(rd_map != NULL);
+
+    const ifx_range_doppler_config_f32_t* config = &engine->config;
+    int32_t status;
+
+    if (config->input_type == IFX_FFT_TYPE_REAL)
+    {
+        status = ifx_range_fft_oop_f32(&engine->range_plan, frame, engine->range,
+                                       engine->scratch, config->num_chirps_per_frame);
+    }
+    else
+    {
+        status = ifx_range_cfft_oop_f32(&engine->range_plan, (const cfloat32_t*)frame,
+                                        engine->range, config->num_chirps_per_frame);
+
+        if ((status == IFX_SENSOR_DSP_STATUS_OK) &&
+            (config->num_range_bins != config->num_samples_per_chirp))
+        {
+            /* Compact the gated bins, rows only move towards the front */
+            for (uint32_t chirp_idx = 0; chirp_idx < config->num_chirps_per_frame; ++chirp_idx)
+            {
+                (void)memmove(&engine->range[chirp_idx * config->num_range_bins],
+                              &engine->range[(chirp_idx * config->num_samples_per_chirp) +
+                                             config->first_range_bin],
+                              config->num_range_bins * sizeof(cfloat32_t));
+            }
+        }
+    }
+
+    if (status != IFX_SENSOR_DSP_STATUS_OK)
+    {
+        return status;
+    }
+
+    if (config->output == IFX_DOPPLER_OUTPUT_COMPLEX)
+    {
+        status = ifx_doppler_cfft_exec_f32(&engine->doppler_plan, engine->range,
+                                           (cfloat32_t*)rd_map, config->num_range_bins);
+    }
+    else
+    {
+        status = ifx_doppler_cfft_map_f32(&engine->doppler_plan, engine->range,
+                                          (float32_t*)rd_map, config->num_range_bins,
+                                          config->output, engine->doppler_scratch);
+    }
+
+    return status;
+}
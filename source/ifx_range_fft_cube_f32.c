@@ -0,0 +1,126 @@
+/***************************************************************************//**
+* \file ifx_range_fft_cube_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_range_fft_cube_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+/** @brief Gather one chirp with arbitrary sample stride into a contiguous work buffer
+ *
+ * Mean removal and windowing are fused with the gather, the mean is calculated in a read-only
+ * strided pass. The chirp is zero padded up to the FFT length.
+ */
+static void gather_chirp(const ifx_fft_plan_f32_t* plan,
+                         const float32_t* src,
+                         uint32_t sample_stride,
+                         float32_t* work)
+{
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    float32_t mean = 0.0f;
+    if (plan->mean_removal)
+    {
+        const float32_t* pSrc = src;
+        for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+        {
+            mean += *pSrc;
+            pSrc += sample_stride;
+        }
+        mean /= (float32_t)num_samples_per_chirp;
+    }
+
+    if (plan->win == NULL)
+    {
+        for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+        {
+            work[n] = *src - mean;
+            src += sample_stride;
+        }
+    }
+    else
+    {
+        for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+        {
+            work[n] = (*src - mean) * ifx_fft_plan_win_f32(plan, n);
+            src += sample_stride;
+        }
+    }
+
+    if (num_samples_per_chirp < plan->fft_len)
+    {
+        arm_fill_f32(0.0f, &work[num_samples_per_chirp], plan->fft_len - num_samples_per_chirp);
+    }
+}
+
+
+int32_t ifx_range_fft_cube_f32(const ifx_fft_plan_f32_t* plan,
+                               const float32_t* cube,
+                               const ifx_radar_cube_layout_t* layout,
+                               cfloat32_t* range,
+                               float32_t* scratch)
+{
+    assert(plan != NULL);
+    assert(cube != NULL);
+    assert(layout != NULL);
+    assert(range != NULL);
+    assert(scratch != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_REAL)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+    const uint16_t num_chirps_per_frame = layout->num_chirps_per_frame;
+    const int32_t num_rx = (int32_t)layout->num_rx;
+
+#if defined(IFX_SENSOR_DSP_USE_OPENMP)
+    #pragma omp parallel for
+#endif
+    for (int32_t rx_idx = 0; rx_idx < num_rx; ++rx_idx)
+    {
+        const float32_t* rx_data = cube + ((uint32_t)rx_idx * layout->rx_stride);
+        cfloat32_t* rx_range = range + ((uint32_t)rx_idx * num_chirps_per_frame * plan->num_bins);
+        float32_t* work = scratch + ((uint32_t)rx_idx * plan->fft_len);
+
+        if ((layout->sample_stride == 1U) && (layout->chirp_stride == num_samples_per_chirp))
+        {
+            /* Contiguous chirps of one channel */
+            (void)ifx_range_fft_oop_f32(plan, rx_data, rx_range, work, num_chirps_per_frame);
+        }
+        else
+        {
+            for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+            {
+                gather_chirp(plan, rx_data, layout->sample_stride, work);
+
+                ifx_range_fft_transform_f32(plan, work, rx_range);
+
+                rx_data += layout->chirp_stride;
+                rx_range += plan->num_bins;
+            }
+        }
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
@@ -3,7 +3,7 @@
 *
 * \brief
 * This file contains the implementation for the
-* ifx_range_fft_f32 function
+* ifx_range_fft_exec_f32, ifx_range_fft_oop_f32 and ifx_range_fft_f32 functions
 *
 *******************************************************************************
 * \copyright
@@ -25,43 +25,215 @@
 
 #include "ifx_sensor_dsp.h"
 
-int32_t ifx_range_fft_f32(float32_t* frame,
-                          cfloat32_t* range,
-                          bool mean_removal,
-                          const float32_t* win,
-                          uint16_t num_samples_per_chirp,
-                          uint16_t num_chirps_per_frame)
+/** @brief Calculate range FFT of one chirp
+ *
+ * Mean removal and windowing read src and write into work, followed by zero padding up to the
+ * FFT length, then work is transformed. src and work can be equal, the contents of work are
+ * destroyed by the FFT.
+ */
+static void range_fft_chirp(const ifx_fft_plan_f32_t* plan,
+                            const float32_t* src,
+                            float32_t* work,
+                            cfloat32_t* range)
 {
-    assert(frame != NULL);
-    assert(range != NULL);
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    if (plan->win_half)
+    {
+        ifx_window_half_apply_f32(src, work, plan->win, plan->mean_removal,
+                                  num_samples_per_chirp);
+    }
+    else if (plan->mean_removal)
+    {
+        ifx_mean_removal_window_f32(src, work, plan->win, num_samples_per_chirp);
+    }
+    else if (plan->win != NULL)
+    {
+        arm_mult_f32(src, plan->win, work, num_samples_per_chirp);
+    }
+    else if (src != work)
+    {
+        arm_copy_f32(src, work, num_samples_per_chirp);
+    }
+    else
+    {
+        //added empty else because of MISRA C-2012 15.7
+    }
 
-    static arm_rfft_fast_instance_f32 rfft = { 0 };
-    if (rfft.fftLenRFFT != num_samples_per_chirp)
+    if (num_samples_per_chirp < plan->fft_len)
     {
-        if (arm_rfft_fast_init_f32(&rfft, num_samples_per_chirp) != ARM_MATH_SUCCESS)
+        arm_fill_f32(0.0f, &work[num_samples_per_chirp], plan->fft_len - num_samples_per_chirp);
+    }
+
+    ifx_range_fft_transform_f32(plan, work, range);
+}
+
+
+/** @brief Calculate mean of one chirp if mean removal is enabled in the plan, zero otherwise */
+static float32_t chirp_mean(const ifx_fft_plan_f32_t* plan, const float32_t* src)
+{
+    float32_t mean = 0.0f;
+
+    if (plan->mean_removal)
+    {
+        arm_mean_f32(src, plan->num_samples, &mean);
+    }
+
+    return mean;
+}
+
+
+/** @brief Calculate range FFT of two chirps with one complex FFT
+ *
+ * Chirp a is packed into the real and chirp b into the imaginary part of work, fused with mean
+ * removal, windowing and zero padding. After the complex FFT the spectra are separated by
+ * A[k] = (Z[k] + conj(Z[N-k])) / 2 and B[k] = (Z[k] - conj(Z[N-k])) / 2j.
+ * src_b can be NULL, then only range_a is written.
+ */
+static void range_fft_pair(const ifx_fft_plan_f32_t* plan,
+                           const float32_t* src_a,
+                           const float32_t* src_b,
+                           float32_t* work,
+                           cfloat32_t* range_a,
+                           cfloat32_t* range_b)
+{
+    const uint32_t fft_len = plan->fft_len;
+    const uint32_t num_samples = plan->num_samples;
+    const float32_t mean_a = chirp_mean(plan, src_a);
+    const float32_t mean_b = (src_b != NULL) ? chirp_mean(plan, src_b) : 0.0f;
+
+    for (uint32_t n = 0; n < num_samples; ++n)
+    {
+        const float32_t w = ifx_fft_plan_win_f32(plan, n);
+        work[2U * n] = (src_a[n] - mean_a) * w;
+        work[(2U * n) + 1U] = (src_b != NULL) ? ((src_b[n] - mean_b) * w) : 0.0f;
+    }
+
+    if (num_samples < fft_len)
+    {
+        arm_fill_f32(0.0f, &work[2U * num_samples], 2U * (fft_len - num_samples));
+    }
+
+    arm_cfft_f32(&plan->cfft, work, 0, 1);
+
+    float32_t* pOutA = (float32_t*)range_a;
+    float32_t* pOutB = (float32_t*)range_b;
+
+    for (uint32_t k = plan->first_bin; k < ((uint32_t)plan->first_bin + plan->num_bins); ++k)
+    {
+        const uint32_t k_mirror = (k == 0U) ? 0U : (fft_len - k);
+        const float32_t xR = work[2U * k];
+        const float32_t xI = work[(2U * k) + 1U];
+        const float32_t yR = work[2U * k_mirror];
+        const float32_t yI = work[(2U * k_mirror) + 1U];
+
+        *pOutA++ = 0.5f * (xR + yR);
+        *pOutA++ = 0.5f * (xI - yI);
+
+        if (src_b != NULL)
         {
-            return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+            *pOutB++ = 0.5f * (xI + yI);
+            *pOutB++ = 0.5f * (yR - xR);
         }
     }
+}
+
+
+int32_t ifx_range_fft_exec_f32(const ifx_fft_plan_f32_t* plan,
+                               float32_t* frame,
+                               cfloat32_t* range,
+                               uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
+    assert(frame != NULL);
+    assert(range != NULL);
+
+    /* Each chirp is processed in-place, zero padding does not fit into the frame */
+    if ((plan->type != IFX_FFT_TYPE_REAL) || (plan->num_samples != plan->fft_len))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_samples_per_chirp = plan->fft_len;
 
     for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
     {
-        if (mean_removal)
+        range_fft_chirp(plan, frame, frame, range);
+
+        frame += num_samples_per_chirp;
+        range += plan->num_bins;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+int32_t ifx_range_fft_oop_f32(const ifx_fft_plan_f32_t* plan,
+                              const float32_t* frame,
+                              cfloat32_t* range,
+                              float32_t* scratch,
+                              uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
+    assert(frame != NULL);
+    assert(range != NULL);
+    assert(scratch != NULL);
+
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    if (plan->type == IFX_FFT_TYPE_REAL)
+    {
+        for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
         {
-            ifx_mean_removal_f32(frame, num_samples_per_chirp);
+            range_fft_chirp(plan, frame, scratch, range);
+
+            frame += num_samples_per_chirp;
+            range += plan->num_bins;
+        }
+    }
+    else if (plan->type == IFX_FFT_TYPE_REAL_PAIR)
+    {
+        uint32_t chirp_idx = 0U;
+        for (; (chirp_idx + 1U) < num_chirps_per_frame; chirp_idx += 2U)
+        {
+            range_fft_pair(plan, frame, &frame[num_samples_per_chirp], scratch,
+                           range, &range[plan->num_bins]);
+
+            frame += 2U * num_samples_per_chirp;
+            range += 2U * plan->num_bins;
         }
 
-        if (win != NULL)
+        if (chirp_idx < num_chirps_per_frame)
         {
-            arm_mult_f32(frame, win, frame, num_samples_per_chirp);
+            range_fft_pair(plan, frame, NULL, scratch, range, NULL);
         }
+    }
+    else
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
 
-        arm_rfft_fast_f32(&rfft, frame, (float32_t*)range, 0);
-        CIMAG_F32(range[0]) = 0.0f;
 
-        frame += num_samples_per_chirp;
-        range += (num_samples_per_chirp / 2U);
+int32_t ifx_range_fft_f32(float32_t* frame,
+                          cfloat32_t* range,
+                          bool mean_removal,
+                          const float32_t* win,
+                          uint16_t num_samples_per_chirp,
+                          uint16_t num_chirps_per_frame)
+{
+    assert(frame != NULL);
+    assert(range != NULL);
+
+    ifx_fft_plan_f32_t plan;
+    int32_t status = ifx_fft_plan_init_f32(&plan, IFX_FFT_TYPE_REAL, num_samples_per_chirp,
+                                           mean_removal, win);
+    if (status == IFX_SENSOR_DSP_STATUS_OK)
+    {
+        status = ifx_range_fft_exec_f32(&plan, frame, range, num_chirps_per_frame);
     }
 
-    return IFX_SENSOR_DSP_STATUS_OK;
+    return status;
 }
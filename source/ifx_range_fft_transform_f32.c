@@ -0,0 +1,97 @@
+/***************************************************************************//**
+* \file ifx_range_fft_transform_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_range_fft_transform_f32 and ifx_range_cfft_transform_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_range_fft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                 float32_t* work,
+                                 cfloat32_t* range)
+{
+    assert(plan != NULL);
+    assert(work != NULL);
+    assert(range != NULL);
+
+    const uint32_t half_len = plan->fft_len / 2U;
+
+    if ((plan->first_bin == 0U) && (plan->num_bins == half_len))
+    {
+        arm_rfft_fast_f32(&plan->rfft, work, (float32_t*)range, 0);
+        CIMAG_F32(range[0]) = 0.0f;
+        return;
+    }
+
+    /* The real FFT of length N is calculated as complex FFT of length N/2 over the even and odd
+     * samples packed as real and imaginary parts, followed by a split stage. Only the split stage
+     * of the gated bins is calculated, using the same twiddle factors as arm_rfft_fast_f32. */
+    arm_cfft_f32(&plan->rfft.Sint, work, 0, 1);
+
+    const float32_t* pCoeff = plan->rfft.pTwiddleRFFT;
+    float32_t* pOut = (float32_t*)range;
+
+    for (uint32_t k = plan->first_bin; k < ((uint32_t)plan->first_bin + plan->num_bins); ++k)
+    {
+        const float32_t xAR = work[2U * k];
+        const float32_t xAI = work[(2U * k) + 1U];
+
+        if (k == 0U)
+        {
+            *pOut++ = xAR + xAI;
+            *pOut++ = 0.0f;
+        }
+        else
+        {
+            const float32_t xBR = work[2U * (half_len - k)];
+            const float32_t xBI = work[(2U * (half_len - k)) + 1U];
+            const float32_t twR = pCoeff[2U * k];
+            const float32_t twI = pCoeff[(2U * k) + 1U];
+
+            const float32_t t1a = xBR - xAR;
+            const float32_t t1b = xBI + xAI;
+
+            *pOut++ = 0.5f * (xAR + xBR + (twR * t1a) + (twI * t1b));
+            *pOut++ = 0.5f * (xAI - xBI + (twI * t1a) - (twR * t1b));
+        }
+    }
+}
+
+
+void ifx_range_cfft_transform_f32(const ifx_fft_plan_f32_t* plan,
+                                  cfloat32_t* work,
+                                  cfloat32_t* range)
+{
+    assert(plan != NULL);
+    assert(work != NULL);
+    assert(range != NULL);
+
+    ifx_cfft_transform_f32(plan, work);
+
+    if ((range != work) || (plan->first_bin != 0U))
+    {
+        /* range may overlap with work when compacting in-place */
+        (void)memmove(range, &work[plan->first_bin], plan->num_bins * sizeof(cfloat32_t));
+    }
+}
@@ -0,0 +1,92 @@
+/***************************************************************************//**
+* \file ifx_range_fft_u16_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_range_fft_u16_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+int32_t ifx_range_fft_u16_f32(const ifx_fft_plan_f32_t* plan,
+                              const uint16_t* frame,
+                              cfloat32_t* range,
+                              float32_t* scratch,
+                              float32_t offset,
+                              float32_t scale,
+                              uint16_t num_chirps_per_frame)
+{
+    assert(plan != NULL);
+    assert(frame != NULL);
+    assert(range != NULL);
+    assert(scratch != NULL);
+
+    if (plan->type != IFX_FFT_TYPE_REAL)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    const uint16_t num_samples_per_chirp = plan->num_samples;
+
+    for (uint32_t chirp_idx = 0; chirp_idx < num_chirps_per_frame; ++chirp_idx)
+    {
+        float32_t bias = offset;
+        if (plan->mean_removal)
+        {
+            /* The mean replaces the offset, accumulate in integer to keep it exact */
+            uint32_t sum = 0U;
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                sum += frame[n];
+            }
+            bias = (float32_t)sum / (float32_t)num_samples_per_chirp;
+        }
+
+        /* Single pass converting, removing the bias, scaling and windowing */
+        if (plan->win == NULL)
+        {
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                scratch[n] = ((float32_t)frame[n] - bias) * scale;
+            }
+        }
+        else
+        {
+            for (uint32_t n = 0; n < num_samples_per_chirp; ++n)
+            {
+                scratch[n] = ((float32_t)frame[n] - bias) *
+                             (scale * ifx_fft_plan_win_f32(plan, n));
+            }
+        }
+
+        if (num_samples_per_chirp < plan->fft_len)
+        {
+            arm_fill_f32(0.0f, &scratch[num_samples_per_chirp],
+                         plan->fft_len - num_samples_per_chirp);
+        }
+
+        ifx_range_fft_transform_f32(plan, scratch, range);
+
+        frame += num_samples_per_chirp;
+        range += plan->num_bins;
+    }
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
@@ -0,0 +1,188 @@
+/***************************************************************************//**
+* \file ifx_range_zoom_fft_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_zoom_fft_buffer_size_f32, ifx_zoom_fft_plan_init_f32 and ifx_range_zoom_fft_f32
+* functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+/** Largest power of two FFT length supported by arm_cfft_f32 */
+#define ZOOM_MAX_CONV_LEN (4096U)
+
+/** Smallest power of two FFT length used for the convolution */
+#define ZOOM_MIN_CONV_LEN (16U)
+
+/** @brief Power of two length of the chirp-z convolution, at least num_samples + num_points - 1 */
+static uint32_t conv_len(uint32_t num_samples, uint32_t num_points)
+{
+    uint32_t len = ZOOM_MIN_CONV_LEN;
+
+    while (len < ((num_samples + num_points) - 1U))
+    {
+        len *= 2U;
+    }
+
+    return len;
+}
+
+
+/** @brief Store exp(-pi i idx / half_period) */
+static void store_phasor(float32_t* dst, uint64_t idx, uint64_t half_period)
+{
+    const float32_t phase = -PI * ((float32_t)idx / (float32_t)half_period);
+
+    dst[0] = arm_cos_f32(phase);
+    dst[1] = arm_sin_f32(phase);
+}
+
+
+uint32_t ifx_zoom_fft_buffer_size_f32(const ifx_fft_plan_f32_t* plan, uint16_t num_points)
+{
+    assert(plan != NULL);
+
+    const uint32_t len = conv_len(plan->num_samples, num_points);
+
+    return (len <= ZOOM_MAX_CONV_LEN) ? (2U * (num_points + (2U * len))) : 0U;
+}
+
+
+int32_t ifx_zoom_fft_plan_init_f32(ifx_zoom_fft_plan_f32_t* zoom_plan,
+                                   const ifx_fft_plan_f32_t* plan,
+                                   uint16_t zoom,
+                                   uint16_t num_points,
+                                   float32_t* buffer,
+                                   uint32_t buffer_len)
+{
+    assert(zoom_plan != NULL);
+    assert(plan != NULL);
+
+    const uint32_t size = ifx_zoom_fft_buffer_size_f32(plan, num_points);
+
+    if (((plan->type != IFX_FFT_TYPE_REAL) && (plan->type != IFX_FFT_TYPE_REAL_PAIR)) ||
+        (zoom == 0U) || (num_points == 0U) || (size == 0U) || (buffer == NULL) ||
+        (buffer_len < size))
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    (void)memset(zoom_plan, 0, sizeof(ifx_zoom_fft_plan_f32_t));
+
+    const uint32_t len = conv_len(plan->num_samples, num_points);
+
+    if (arm_cfft_init_f32(&zoom_plan->cfft, (uint16_t)len) != ARM_MATH_SUCCESS)
+    {
+        return IFX_SENSOR_DSP_ARGUMENT_ERROR;
+    }
+
+    /* All phases are multiples of pi / (zoom * fft_len), reduced modulo 2 * zoom * fft_len */
+    const uint64_t half_period = (uint64_t)zoom * plan->fft_len;
+    float32_t* post_chirp = buffer;
+    float32_t* filter_fft = &buffer[2U * num_points];
+
+    /* Output chirp W^(k^2/2) with W = exp(-2 pi i / (zoom * fft_len)) */
+    for (uint32_t k = 0; k < num_points; ++k)
+    {
+        store_phasor(&post_chirp[2U * k], ((uint64_t)k * k) % (2U * half_period), half_period);
+    }
+
+    /* Filter W^(-m^2/2) for m = -(num_samples - 1) ... num_points - 1, stored circularly */
+    arm_fill_f32(0.0f, filter_fft, 2U * len);
+    for (uint32_t m = 0; m < num_points; ++m)
+    {
+        store_phasor(&filter_fft[2U * m], ((uint64_t)m * m) % (2U * half_period), half_period);
+        filter_fft[(2U * m) + 1U] = -filter_fft[(2U * m) + 1U];
+    }
+    for (uint32_t m = 1U; m < plan->num_samples; ++m)
+    {
+        float32_t* pDst = &filter_fft[2U * (len - m)];
+        store_phasor(pDst, ((uint64_t)m * m) % (2U * half_period), half_period);
+        pDst[1] = -pDst[1];
+    }
+
+    arm_cfft_f32(&zoom_plan->cfft, filter_fft, 0, 1);
+
+    zoom_plan->plan = plan;
+    zoom_plan->zoom = zoom;
+    zoom_plan->num_points = num_points;
+    zoom_plan->conv_len = (uint16_t)len;
+    zoom_plan->buffer = buffer;
+
+    return IFX_SENSOR_DSP_STATUS_OK;
+}
+
+
+void ifx_range_zoom_fft_f32(const ifx_zoom_fft_plan_f32_t* zoom_plan,
+                            const float32_t* chirp,
+                            uint16_t peak_bin,
+                            cfloat32_t* spectrum)
+{
+    assert(zoom_plan != NULL);
+    assert(zoom_plan->plan != NULL);
+    assert(chirp != NULL);
+    assert(spectrum != NULL);
+
+    const ifx_fft_plan_f32_t* plan = zoom_plan->plan;
+    const uint32_t num_samples = plan->num_samples;
+    const uint32_t num_points = zoom_plan->num_points;
+    const uint32_t len = zoom_plan->conv_len;
+    const uint64_t half_period = (uint64_t)zoom_plan->zoom * plan->fft_len;
+    const uint64_t period = 2U * half_period;
+    const float32_t* post_chirp = zoom_plan->buffer;
+    const float32_t* filter_fft = &zoom_plan->buffer[2U * num_points];
+    float32_t* work = &zoom_plan->buffer[2U * (num_points + len)];
+
+    /* First point in units of 1/zoom bins, points are centered on the peak bin */
+    const int64_t first_point = ((int64_t)peak_bin * zoom_plan->zoom) - (int64_t)(num_points / 2U);
+    const uint64_t start = (uint64_t)(((first_point % (int64_t)period) + (int64_t)period) %
+                                      (int64_t)period);
+
+    float32_t mean = 0.0f;
+    if (plan->mean_removal)
+    {
+        arm_mean_f32(chirp, num_samples, &mean);
+    }
+
+    /* Input chirp A^(-n) * W^(n^2/2), the phase index 2 * start * n + n^2 is updated
+     * incrementally by 2 * start + 2 * n + 1 */
+    uint64_t idx = 0U;
+    for (uint32_t n = 0; n < num_samples; ++n)
+    {
+        const float32_t sample = (chirp[n] - mean) * ifx_fft_plan_win_f32(plan, n);
+
+        store_phasor(&work[2U * n], idx, half_period);
+        work[2U * n] *= sample;
+        work[(2U * n) + 1U] *= sample;
+
+        idx = (idx + (2U * start) + (2U * (uint64_t)n) + 1U) % period;
+    }
+
+    arm_fill_f32(0.0f, &work[2U * num_samples], 2U * (len - num_samples));
+
+    arm_cfft_f32(&zoom_plan->cfft, work, 0, 1);
+    arm_cmplx_mult_cmplx_f32(work, filter_fft, work, len);
+    arm_cfft_f32(&zoom_plan->cfft, work, 1, 1);
+
+    arm_cmplx_mult_cmplx_f32(work, post_chirp, (float32_t*)spectrum, num_points);
+}
@@ -29,14 +29,18 @@ void ifx_rotate_f32(float32_t* v, uint32_t len, uint32_t k)
 {
     assert(v != NULL);
 
-    while (k > 0U)
+    if (len == 0U)
     {
-        const float32_t temp = v[0];
-        for (uint32_t j = 0; j < (len - 1U); ++j)
-        {
-            v[j] = v[j + 1U];
-        }
-        v[len - 1U] = temp;
-        --k;
+        return;
+    }
+
+    k = k % len;
+
+    /* Rotation by reversing both parts and then the whole array, each element moves twice */
+    if (k > 0U)
+    {
+        ifx_flip_f32(v, k);
+        ifx_flip_f32(&v[k], len - k);
+        ifx_flip_f32(v, len);
     }
 }
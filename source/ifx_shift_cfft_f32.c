@@ -3,7 +3,7 @@
 *
 * \brief
 * This file contains the implementation for the
-* ifx_shift_cfft_f32 function
+* ifx_shift_cfft_f32, ifx_shift_cfft_oop_f32 and ifx_shift_cfft_2d_f32 functions
 *
 *******************************************************************************
 * \copyright
@@ -35,3 +35,59 @@ void ifx_shift_cfft_f32(cfloat32_t* v, uint32_t len, uint32_t dim)
         v += len;
     }
 }
+
+
+void ifx_shift_cfft_oop_f32(const cfloat32_t* src, cfloat32_t* dst, uint32_t len, uint32_t dim)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(src != dst);
+
+    /* dst[j] = src[(j + half) % len], half rounded up for odd lengths */
+    const uint32_t half = (len + 1U) / 2U;
+
+    for (uint32_t i = 0; i < dim; ++i)
+    {
+        arm_copy_f32((const float32_t*)&src[half], (float32_t*)dst, 2U * (len - half));
+        arm_copy_f32((const float32_t*)src, (float32_t*)&dst[len - half], 2U * half);
+        src += len;
+        dst += len;
+    }
+}
+
+
+void ifx_shift_cfft_2d_f32(cfloat32_t* map, uint32_t num_rows, uint32_t num_cols)
+{
+    assert(map != NULL);
+
+    if (((num_rows % 2U) == 0U) && ((num_cols % 2U) == 0U))
+    {
+        /* Swap the diagonal quadrants in a single pass */
+        const uint32_t half_rows = num_rows / 2U;
+        const uint32_t half_cols = num_cols / 2U;
+
+        for (uint32_t row = 0; row < half_rows; ++row)
+        {
+            cfloat32_t* upper = &map[row * num_cols];
+            cfloat32_t* lower = &map[(row + half_rows) * num_cols];
+
+            for (uint32_t col = 0; col < half_cols; ++col)
+            {
+                cfloat32_t temp = upper[col];
+                upper[col] = lower[col + half_cols];
+                lower[col + half_cols] = temp;
+
+                temp = upper[col + half_cols];
+                upper[col + half_cols] = lower[col];
+                lower[col] = temp;
+            }
+        }
+    }
+    else
+    {
+        /* Odd dimensions: shift the rows, then rotate the map by whole rows */
+        ifx_shift_cfft_f32(map, num_cols, num_rows);
+        ifx_rotate_f32((float32_t*)map, 2U * num_rows * num_cols,
+                       2U * ((num_rows + 1U) / 2U) * num_cols);
+    }
+}
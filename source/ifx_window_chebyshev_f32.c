@@ -0,0 +1,102 @@
+/***************************************************************************//**
+* \file ifx_window_chebyshev_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_chebyshev_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <math.h>
+
+#include "ifx_sensor_dsp.h"
+
+/** @brief Chebyshev polynomial of the given order, also for |x| > 1
+ *
+ * CMSIS-DSP provides no inverse or hyperbolic functions, acosf, acoshf and coshf are taken from
+ * the C math library.
+ */
+static float32_t chebyshev_poly(uint32_t order, float32_t x)
+{
+    float32_t p;
+
+    if (x > 1.0F)
+    {
+        p = coshf((float32_t)order * acoshf(x));
+    }
+    else if (x < -1.0F)
+    {
+        p = coshf((float32_t)order * acoshf(-x));
+        p = ((order % 2U) == 1U) ? -p : p;
+    }
+    else
+    {
+        p = arm_cos_f32((float32_t)order * acosf(x));
+    }
+
+    return p;
+}
+
+
+void ifx_window_chebyshev_f32(float32_t* win, uint32_t len, float32_t attenuation)
+{
+    assert(win != NULL);
+    assert(len > 1U);
+    assert(attenuation > 0.0F);
+
+    const uint32_t order = len - 1U;
+    const float32_t beta = coshf(acoshf(powf(10.0F, attenuation / 20.0F)) / (float32_t)order);
+
+    /* The window is the inverse DFT of the frequency response
+     * W_k = T_order(beta * cos(pi k / len)), shifted to be centered. With d = 2 n - (len - 1)
+     * this is w_n = sum_k W_k * cos(pi k d / len), the phase k * d is reduced modulo 2 * len.
+     * W_(len - k) = (-1)^order * W_k, so W_1 ... W_(len / 2) are stored in the first half of win,
+     * which is free until the second half of the symmetric window is calculated and mirrored. */
+    const float32_t sign = ((order % 2U) == 1U) ? -1.0F : 1.0F;
+    const float32_t W0 = chebyshev_poly(order, beta);
+
+    for (uint32_t k = 1U; k <= (len / 2U); ++k)
+    {
+        win[k - 1U] = chebyshev_poly(order, beta * arm_cos_f32(PI * (float32_t)k / (float32_t)len));
+    }
+
+    float32_t max = 0.0F;
+    for (uint32_t n = len / 2U; n < len; ++n)
+    {
+        const uint32_t d = (2U * n) - order;
+        float32_t sum = W0;
+
+        for (uint32_t k = 1U; k < len; ++k)
+        {
+            const float32_t W = (k <= (len / 2U)) ? win[k - 1U] : (sign * win[len - k - 1U]);
+            const uint32_t r = (k * d) % (2U * len);
+            sum += W * arm_cos_f32(PI * (float32_t)r / (float32_t)len);
+        }
+
+        win[n] = sum;
+        max = (sum > max) ? sum : max;
+    }
+
+    for (uint32_t n = len / 2U; n < len; ++n)
+    {
+        win[n] /= max;
+        win[len - 1U - n] = win[n];
+    }
+}
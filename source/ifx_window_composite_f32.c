@@ -0,0 +1,84 @@
+/***************************************************************************//**
+* \file ifx_window_composite_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_composite_f32 and ifx_cmplx_window_composite_apply_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_window_composite_f32(const float32_t* win,
+                              uint32_t len,
+                              float32_t scale,
+                              cfloat32_t gain,
+                              cfloat32_t* cwin)
+{
+    assert(cwin != NULL);
+
+    const cfloat32_t scaled_gain = gain * scale;
+
+    for (uint32_t n = 0; n < len; ++n)
+    {
+        cwin[n] = (win != NULL) ? (scaled_gain * win[n]) : scaled_gain;
+    }
+}
+
+
+void ifx_cmplx_window_composite_apply_f32(const cfloat32_t* src,
+                                          cfloat32_t* dst,
+                                          const cfloat32_t* cwin,
+                                          bool mean_removal,
+                                          uint32_t len)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(cwin != NULL);
+
+    const float32_t* pSrc = (const float32_t*)src;
+    const float32_t* pWin = (const float32_t*)cwin;
+    float32_t* pDst = (float32_t*)dst;
+    float32_t mean_real = 0.0f;
+    float32_t mean_imag = 0.0f;
+
+    if (mean_removal)
+    {
+        for (uint32_t n = 0; n < len; ++n)
+        {
+            mean_real += pSrc[2U * n];
+            mean_imag += pSrc[(2U * n) + 1U];
+        }
+        mean_real /= (float32_t)len;
+        mean_imag /= (float32_t)len;
+    }
+
+    /* Single load/store pass computing (x - mean) * c, written out to avoid the overhead of
+     * complex multiplication with IEEE special case handling */
+    for (uint32_t n = 0; n < len; ++n)
+    {
+        const float32_t xR = pSrc[2U * n] - mean_real;
+        const float32_t xI = pSrc[(2U * n) + 1U] - mean_imag;
+        const float32_t cR = pWin[2U * n];
+        const float32_t cI = pWin[(2U * n) + 1U];
+
+        pDst[2U * n] = (xR * cR) - (xI * cI);
+        pDst[(2U * n) + 1U] = (xR * cI) + (xI * cR);
+    }
+}
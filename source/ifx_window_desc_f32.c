@@ -0,0 +1,52 @@
+/***************************************************************************//**
+* \file ifx_window_desc_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_desc_init_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_window_desc_init_f32(ifx_window_desc_f32_t* desc, const float32_t* win, uint32_t len)
+{
+    assert(desc != NULL);
+    assert(win != NULL);
+    assert(len > 0U);
+
+    float32_t sum = 0.0F;
+    float32_t sum_sq = 0.0F;
+
+    for (uint32_t n = 0; n < len; ++n)
+    {
+        sum += win[n];
+        sum_sq += win[n] * win[n];
+    }
+
+    assert(sum != 0.0F);
+
+    desc->win = win;
+    desc->len = len;
+    desc->sum = sum;
+    desc->sum_sq = sum_sq;
+    desc->coherent_gain = sum / (float32_t)len;
+    desc->enbw = ((float32_t)len * sum_sq) / (sum * sum);
+}
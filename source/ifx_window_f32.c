@@ -0,0 +1,271 @@
+/***************************************************************************//**
+* \file ifx_window_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_cosine_sum_f32, ifx_window_f32, ifx_window_half_f32,
+* ifx_window_cosine_sum_fast_f32 and ifx_window_fast_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+/** Cosine-sum coefficients of the Hann window */
+static const float32_t hann_coeffs[] = {0.5F, 0.5F};
+
+/** Cosine-sum coefficients of the Hamming window */
+static const float32_t hamming_coeffs[] = {0.54F, 0.46F};
+
+/** Cosine-sum coefficients of the Blackman window */
+static const float32_t blackman_coeffs[] = {0.42F, 0.50F, 0.08F};
+
+/** Cosine-sum coefficients of the four-term Blackman-Harris window */
+static const float32_t blackmanharris_coeffs[] = {0.35875F, 0.48829F, 0.14128F, 0.01168F};
+
+/** @brief Cosine-sum coefficients of a window type */
+static const float32_t* window_coeffs(ifx_window_type_t type, uint32_t* num_coeffs)
+{
+    const float32_t* coeffs;
+
+    switch (type)
+    {
+        case IFX_WINDOW_HAMMING:
+            coeffs = hamming_coeffs;
+            *num_coeffs = 2U;
+            break;
+
+        case IFX_WINDOW_BLACKMAN:
+            coeffs = blackman_coeffs;
+            *num_coeffs = 3U;
+            break;
+
+        case IFX_WINDOW_BLACKMANHARRIS:
+            coeffs = blackmanharris_coeffs;
+            *num_coeffs = 4U;
+            break;
+
+        case IFX_WINDOW_HANN:
+        default:
+            coeffs = hann_coeffs;
+            *num_coeffs = 2U;
+            break;
+    }
+
+    return coeffs;
+}
+
+
+/** @brief Calculate the first num_values values of a cosine-sum window with M = 1 / D */
+static void cosine_sum(float32_t* win,
+                       uint32_t num_values,
+                       float32_t M,
+                       const float32_t* coeffs,
+                       uint32_t num_coeffs)
+{
+    for (uint32_t n = 0; n < num_values; ++n)
+    {
+        float32_t value = coeffs[0];
+
+        for (uint32_t k = 1U; k < num_coeffs; ++k)
+        {
+            const float32_t term = coeffs[k] *
+                                   arm_cos_f32(2.0F * (float32_t)k * PI * (float32_t)n * M);
+            value = ((k % 2U) == 1U) ? (value - term) : (value + term);
+        }
+
+        win[n] = value;
+    }
+}
+
+
+/** @brief Calculate cos(2 pi x) and sin(2 pi x) for 0 <= x <= 1 close to float precision
+ *
+ * arm_cos_f32 and arm_sin_f32 interpolate a table with an error of about 2e-5, which the
+ * rotation and the Chebyshev recurrence in cosine_sum_fast would amplify. The angle is reduced
+ * to |a| <= pi / 4 around the nearest quarter turn and evaluated by Taylor polynomials, whose
+ * truncation error is below 2e-9.
+ */
+static void cos_sin_turns(float32_t x, float32_t* c, float32_t* s)
+{
+    const uint32_t quadrant = (uint32_t)((4.0F * x) + 0.5F);
+    const float32_t a = 2.0F * PI * (x - (0.25F * (float32_t)quadrant));
+    const float32_t a2 = a * a;
+    const float32_t ca = 1.0F - ((a2 / 2.0F) * (1.0F - ((a2 / 12.0F) *
+                                 (1.0F - ((a2 / 30.0F) * (1.0F - ((a2 / 56.0F) *
+                                 (1.0F - (a2 / 90.0F)))))))));
+    const float32_t sa = a * (1.0F - ((a2 / 6.0F) * (1.0F - ((a2 / 20.0F) *
+                              (1.0F - ((a2 / 42.0F) * (1.0F - (a2 / 72.0F))))))));
+
+    switch (quadrant % 4U)
+    {
+        case 1U:
+            *c = -sa;
+            *s = ca;
+            break;
+
+        case 2U:
+            *c = -ca;
+            *s = -sa;
+            break;
+
+        case 3U:
+            *c = sa;
+            *s = -ca;
+            break;
+
+        default:
+            *c = ca;
+            *s = sa;
+            break;
+    }
+}
+
+
+/** @brief Calculate the first num_values values of a cosine-sum window with M = 1 / D by
+ * recurrence
+ *
+ * The unit phasor exp(i 2 pi n M) is advanced by one complex rotation per sample and re-anchored
+ * every IFX_WINDOW_FAST_BLOCK samples, which bounds the accumulated rounding error. Rotation and
+ * anchors are evaluated by cos_sin_turns instead of the table based arm_cos_f32 and
+ * arm_sin_f32. The higher harmonics cos(2 pi k n M) are derived from c = cos(2 pi n M) by the
+ * Chebyshev recurrence T_k = 2 c T_(k-1) - T_(k-2).
+ */
+static void cosine_sum_fast(float32_t* win,
+                            uint32_t num_values,
+                            float32_t M,
+                            const float32_t* coeffs,
+                            uint32_t num_coeffs)
+{
+    float32_t step_cos;
+    float32_t step_sin;
+    float32_t c = 1.0F;
+    float32_t s = 0.0F;
+
+    cos_sin_turns(M, &step_cos, &step_sin);
+
+    for (uint32_t n = 0; n < num_values; ++n)
+    {
+        if ((n % IFX_WINDOW_FAST_BLOCK) == 0U)
+        {
+            cos_sin_turns((float32_t)n * M, &c, &s);
+        }
+        else
+        {
+            const float32_t rotated = (c * step_cos) - (s * step_sin);
+            s = (s * step_cos) + (c * step_sin);
+            c = rotated;
+        }
+
+        float32_t t_prev = 1.0F;
+        float32_t t_k = c;
+        float32_t value = coeffs[0];
+
+        for (uint32_t k = 1U; k < num_coeffs; ++k)
+        {
+            if (k > 1U)
+            {
+                const float32_t t_next = (2.0F * c * t_k) - t_prev;
+                t_prev = t_k;
+                t_k = t_next;
+            }
+
+            const float32_t term = coeffs[k] * t_k;
+            value = ((k % 2U) == 1U) ? (value - term) : (value + term);
+        }
+
+        win[n] = value;
+    }
+}
+
+
+void ifx_window_cosine_sum_f32(float32_t* win,
+                               uint32_t len,
+                               const float32_t* coeffs,
+                               uint32_t num_coeffs,
+                               bool periodic)
+{
+    assert(win != NULL);
+    assert(coeffs != NULL);
+    assert(num_coeffs > 0U);
+    assert(periodic || (len > 1U));
+
+    const float32_t M = periodic ? (1.0F / (float32_t)len) : (1.0F / ((float32_t)len - 1.0F));
+
+    cosine_sum(win, len, M, coeffs, num_coeffs);
+}
+
+
+void ifx_window_f32(ifx_window_type_t type, float32_t* win, uint32_t len, bool periodic)
+{
+    assert(win != NULL);
+
+    uint32_t num_coeffs = 0U;
+    const float32_t* coeffs = window_coeffs(type, &num_coeffs);
+
+    ifx_window_cosine_sum_f32(win, len, coeffs, num_coeffs, periodic);
+}
+
+
+void ifx_window_half_f32(ifx_window_type_t type, float32_t* half, uint32_t len)
+{
+    assert(half != NULL);
+    assert(len > 1U);
+
+    uint32_t num_coeffs = 0U;
+    const float32_t* coeffs = window_coeffs(type, &num_coeffs);
+
+    cosine_sum(half, (len + 1U) / 2U, 1.0F / ((float32_t)len - 1.0F), coeffs, num_coeffs);
+}
+
+
+void ifx_window_cosine_sum_fast_f32(float32_t* win,
+                                    uint32_t len,
+                                    const float32_t* coeffs,
+                                    uint32_t num_coeffs,
+                                    bool periodic)
+{
+    assert(win != NULL);
+    assert(coeffs != NULL);
+    assert(num_coeffs > 0U);
+    assert(periodic || (len > 1U));
+
+    /* Only the first half is calculated, a symmetric window satisfies w[n] = w[len - 1 - n] and
+     * a periodic window w[n] = w[len - n] */
+    const float32_t M = periodic ? (1.0F / (float32_t)len) : (1.0F / ((float32_t)len - 1.0F));
+    const uint32_t num_values = periodic ? ((len / 2U) + 1U) : ((len + 1U) / 2U);
+    const uint32_t mirror = periodic ? len : (len - 1U);
+
+    cosine_sum_fast(win, (num_values < len) ? num_values : len, M, coeffs, num_coeffs);
+
+    for (uint32_t n = num_values; n < len; ++n)
+    {
+        win[n] = win[mirror - n];
+    }
+}
+
+
+void ifx_window_fast_f32(ifx_window_type_t type, float32_t* win, uint32_t len, bool periodic)
+{
+    assert(win != NULL);
+
+    uint32_t num_coeffs = 0U;
+    const float32_t* coeffs = window_coeffs(type, &num_coeffs);
+
+    ifx_window_cosine_sum_fast_f32(win, len, coeffs, num_coeffs, periodic);
+}
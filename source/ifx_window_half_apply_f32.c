@@ -0,0 +1,106 @@
+/***************************************************************************//**
+* \file ifx_window_half_apply_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_half_apply_f32 and ifx_cmplx_window_half_apply_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_window_half_apply_f32(const float32_t* src,
+                               float32_t* dst,
+                               const float32_t* half,
+                               bool mean_removal,
+                               uint32_t len)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(half != NULL);
+
+    float32_t offset = 0.0f;
+    if (mean_removal)
+    {
+        arm_mean_f32(src, len, &offset);
+    }
+
+    /* Both ends are processed with the same coefficient, the tail sample is read first so the
+     * middle sample of an odd length is processed once also in place */
+    uint32_t head = 0U;
+    uint32_t tail = len;
+
+    while (head < tail)
+    {
+        --tail;
+        const float32_t w = half[head];
+
+        const float32_t tail_value = src[tail];
+
+        dst[head] = (src[head] - offset) * w;
+        dst[tail] = (tail_value - offset) * w;
+        ++head;
+    }
+}
+
+
+void ifx_cmplx_window_half_apply_f32(const cfloat32_t* src,
+                                     cfloat32_t* dst,
+                                     const float32_t* half,
+                                     bool mean_removal,
+                                     uint32_t len)
+{
+    assert(src != NULL);
+    assert(dst != NULL);
+    assert(half != NULL);
+
+    const float32_t* pSrc = (const float32_t*)src;
+    float32_t* pDst = (float32_t*)dst;
+    float32_t offset_real = 0.0f;
+    float32_t offset_imag = 0.0f;
+
+    if (mean_removal)
+    {
+        for (uint32_t n = 0; n < len; ++n)
+        {
+            offset_real += pSrc[2U * n];
+            offset_imag += pSrc[(2U * n) + 1U];
+        }
+        offset_real /= (float32_t)len;
+        offset_imag /= (float32_t)len;
+    }
+
+    uint32_t head = 0U;
+    uint32_t tail = len;
+
+    while (head < tail)
+    {
+        --tail;
+        const float32_t w = half[head];
+
+        const float32_t tail_real = pSrc[2U * tail];
+        const float32_t tail_imag = pSrc[(2U * tail) + 1U];
+
+        pDst[2U * head] = (pSrc[2U * head] - offset_real) * w;
+        pDst[(2U * head) + 1U] = (pSrc[(2U * head) + 1U] - offset_imag) * w;
+        pDst[2U * tail] = (tail_real - offset_real) * w;
+        pDst[(2U * tail) + 1U] = (tail_imag - offset_imag) * w;
+        ++head;
+    }
+}
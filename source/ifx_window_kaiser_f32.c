@@ -0,0 +1,71 @@
+/***************************************************************************//**
+* \file ifx_window_kaiser_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_kaiser_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "ifx_sensor_dsp.h"
+
+/** Relative size of the last term of the power series of the Bessel function */
+#define KAISER_SERIES_TOLERANCE (1.0e-9F)
+
+/** @brief Zeroth order modified Bessel function of the first kind by its power series
+ * sum_k ((x / 2)^k / k!)^2 */
+static float32_t bessel_i0(float32_t x)
+{
+    const float32_t half_x_sq = 0.25F * x * x;
+    float32_t term = 1.0F;
+    float32_t sum = 1.0F;
+    uint32_t k = 1U;
+
+    while (term > (KAISER_SERIES_TOLERANCE * sum))
+    {
+        term *= half_x_sq / ((float32_t)k * (float32_t)k);
+        sum += term;
+        ++k;
+    }
+
+    return sum;
+}
+
+
+void ifx_window_kaiser_f32(float32_t* win, uint32_t len, float32_t beta)
+{
+    assert(win != NULL);
+    assert(len > 1U);
+    assert(beta >= 0.0F);
+
+    const float32_t M = 2.0F / ((float32_t)len - 1.0F);
+    const float32_t norm = 1.0F / bessel_i0(beta);
+
+    /* The window is symmetric, the first half is calculated and mirrored */
+    for (uint32_t n = 0; n < ((len + 1U) / 2U); ++n)
+    {
+        const float32_t x = ((float32_t)n * M) - 1.0F;
+        float32_t root = 0.0F;
+        (void)arm_sqrt_f32(1.0F - (x * x), &root);
+
+        win[n] = bessel_i0(beta * root) * norm;
+        win[len - 1U - n] = win[n];
+    }
+}
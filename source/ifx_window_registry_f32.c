@@ -0,0 +1,89 @@
+/***************************************************************************//**
+* \file ifx_window_registry_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_registry_init_f32 and ifx_window_registry_get_f32 functions
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_window_registry_init_f32(ifx_window_registry_f32_t* registry,
+                                  float32_t* pool,
+                                  uint32_t pool_len)
+{
+    assert(registry != NULL);
+    assert((pool != NULL) || (pool_len == 0U));
+
+    (void)memset(registry, 0, sizeof(ifx_window_registry_f32_t));
+
+    registry->pool = pool;
+    registry->pool_len = pool_len;
+}
+
+
+const float32_t* ifx_window_registry_get_f32(ifx_window_registry_f32_t* registry,
+                                             ifx_window_type_t type,
+                                             uint32_t len,
+                                             bool periodic)
+{
+    assert(registry != NULL);
+
+    for (uint32_t i = 0; i < registry->num_entries; ++i)
+    {
+        const ifx_window_registry_entry_f32_t* entry = &registry->entries[i];
+
+        if ((entry->type == type) && (entry->len == len) && (entry->periodic == periodic))
+        {
+            return entry->win;
+        }
+    }
+
+    /* Windows generated at build time need no pool memory */
+    const float32_t* table = ifx_window_table_get_f32(type, len, periodic);
+    if (table != NULL)
+    {
+        return table;
+    }
+
+    /* Generate the window into the pool on first use */
+    if ((registry->num_entries >= IFX_WINDOW_REGISTRY_SIZE) ||
+        (len > (registry->pool_len - registry->pool_used)) ||
+        ((len < 2U) && !periodic) || (len == 0U))
+    {
+        return NULL;
+    }
+
+    float32_t* win = &registry->pool[registry->pool_used];
+    ifx_window_f32(type, win, len, periodic);
+
+    ifx_window_registry_entry_f32_t* entry = &registry->entries[registry->num_entries];
+    entry->type = type;
+    entry->len = len;
+    entry->periodic = periodic;
+    entry->win = win;
+
+    registry->num_entries++;
+    registry->pool_used += len;
+
+    return win;
+}
@@ -0,0 +1,217 @@
+/***************************************************************************//**
+* \file ifx_window_tables_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_table_get_f32 function
+*
+* Generated by scripts/gen_window_tables.py, do not edit.
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ifx_sensor_dsp.h"
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HANN_32)
+/** Symmetric hann window of length 32 */
+static const float32_t hann_32[32] = {
+    0.000000000e+00F, 1.023502927e-02F, 4.052109271e-02F, 8.961828053e-02F,
+    1.555165350e-01F, 2.355179936e-01F, 3.263473809e-01F, 4.242860973e-01F,
+    5.253245831e-01F, 6.253262758e-01F, 7.201970816e-01F, 8.060529828e-01F,
+    8.793790340e-01F, 9.371733069e-01F, 9.770696163e-01F, 9.974346757e-01F,
+    9.974346757e-01F, 9.770696163e-01F, 9.371733069e-01F, 8.793790340e-01F,
+    8.060529828e-01F, 7.201970816e-01F, 6.253262758e-01F, 5.253245831e-01F,
+    4.242860973e-01F, 3.263473809e-01F, 2.355179936e-01F, 1.555165350e-01F,
+    8.961828053e-02F, 4.052109271e-02F, 1.023502927e-02F, 0.000000000e+00F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HANN_64)
+/** Symmetric hann window of length 64 */
+static const float32_t hann_64[64] = {
+    0.000000000e+00F, 2.484612400e-03F, 9.913756512e-03F, 2.221359685e-02F,
+    3.926189244e-02F, 6.088921428e-02F, 8.688060939e-02F, 1.169777811e-01F,
+    1.508815885e-01F, 1.882551014e-01F, 2.287268639e-01F, 2.718946636e-01F,
+    3.173294961e-01F, 3.645797670e-01F, 4.131759107e-01F, 4.626349509e-01F,
+    5.124653578e-01F, 5.621718764e-01F, 6.112604737e-01F, 6.592433453e-01F,
+    7.056435347e-01F, 7.500000000e-01F, 7.918718457e-01F, 8.308429122e-01F,
+    8.665259480e-01F, 8.985662460e-01F, 9.266454577e-01F, 9.504844546e-01F,
+    9.698463082e-01F, 9.845386147e-01F, 9.944154024e-01F, 9.993784428e-01F,
+    9.993784428e-01F, 9.944154024e-01F, 9.845386147e-01F, 9.698463082e-01F,
+    9.504844546e-01F, 9.266454577e-01F, 8.985662460e-01F, 8.665259480e-01F,
+    8.308429122e-01F, 7.918718457e-01F, 7.500000000e-01F, 7.056435347e-01F,
+    6.592433453e-01F, 6.112604737e-01F, 5.621718764e-01F, 5.124653578e-01F,
+    4.626349509e-01F, 4.131759107e-01F, 3.645797670e-01F, 3.173294961e-01F,
+    2.718946636e-01F, 2.287268639e-01F, 1.882551014e-01F, 1.508815885e-01F,
+    1.169777811e-01F, 8.688060939e-02F, 6.088921428e-02F, 3.926189244e-02F,
+    2.221359685e-02F, 9.913756512e-03F, 2.484612400e-03F, 0.000000000e+00F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HAMMING_32)
+/** Symmetric hamming window of length 32 */
+static const float32_t hamming_32[32] = {
+    7.999999821e-02F, 8.941622823e-02F, 1.172794104e-01F, 1.624488235e-01F,
+    2.230752110e-01F, 2.966765463e-01F, 3.802395761e-01F, 4.703432322e-01F,
+    5.632986426e-01F, 6.553001404e-01F, 7.425813079e-01F, 8.215687275e-01F,
+    8.890287280e-01F, 9.421994686e-01F, 9.789040685e-01F, 9.976398945e-01F,
+    9.976398945e-01F, 9.789040685e-01F, 9.421994686e-01F, 8.890287280e-01F,
+    8.215687275e-01F, 7.425813079e-01F, 6.553001404e-01F, 5.632986426e-01F,
+    4.703432322e-01F, 3.802395761e-01F, 2.966765463e-01F, 2.230752110e-01F,
+    1.624488235e-01F, 1.172794104e-01F, 8.941622823e-02F, 7.999999821e-02F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HAMMING_64)
+/** Symmetric hamming window of length 64 */
+static const float32_t hamming_64[64] = {
+    7.999999821e-02F, 8.228584379e-02F, 8.912065625e-02F, 1.004365087e-01F,
+    1.161209419e-01F, 1.360180825e-01F, 1.599301696e-01F, 1.876195520e-01F,
+    2.188110650e-01F, 2.531946898e-01F, 2.904287279e-01F, 3.301430941e-01F,
+    3.719431162e-01F, 4.154133797e-01F, 4.601218402e-01F, 5.056241751e-01F,
+    5.514681339e-01F, 5.971981287e-01F, 6.423596144e-01F, 6.865038872e-01F,
+    7.291920781e-01F, 7.699999809e-01F, 8.085221052e-01F, 8.443754911e-01F,
+    8.772038817e-01F, 9.066809416e-01F, 9.325138330e-01F, 9.544456601e-01F,
+    9.722586274e-01F, 9.857755303e-01F, 9.948621988e-01F, 9.994282126e-01F,
+    9.994282126e-01F, 9.948621988e-01F, 9.857755303e-01F, 9.722586274e-01F,
+    9.544456601e-01F, 9.325138330e-01F, 9.066809416e-01F, 8.772038817e-01F,
+    8.443754911e-01F, 8.085221052e-01F, 7.699999809e-01F, 7.291920781e-01F,
+    6.865038872e-01F, 6.423596144e-01F, 5.971981287e-01F, 5.514681339e-01F,
+    5.056241751e-01F, 4.601218402e-01F, 4.154133797e-01F, 3.719431162e-01F,
+    3.301430941e-01F, 2.904287279e-01F, 2.531946898e-01F, 2.188110650e-01F,
+    1.876195520e-01F, 1.599301696e-01F, 1.360180825e-01F, 1.161209419e-01F,
+    1.004365087e-01F, 8.912065625e-02F, 8.228584379e-02F, 7.999999821e-02F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMAN_32)
+/** Symmetric blackman window of length 32 */
+static const float32_t blackman_32[32] = {
+    -1.387778781e-17F, 3.751654411e-03F, 1.563844830e-02F, 3.740270063e-02F,
+    7.146460563e-02F, 1.202864647e-01F, 1.856467277e-01F, 2.679549754e-01F,
+    3.657350242e-01F, 4.753785431e-01F, 5.912286043e-01F, 7.060008049e-01F,
+    8.114932775e-01F, 8.994904160e-01F, 9.627307057e-01F, 9.957970381e-01F,
+    9.957970381e-01F, 9.627307057e-01F, 8.994904160e-01F, 8.114932775e-01F,
+    7.060008049e-01F, 5.912286043e-01F, 4.753785431e-01F, 3.657350242e-01F,
+    2.679549754e-01F, 1.856467277e-01F, 1.202864647e-01F, 7.146460563e-02F,
+    3.740270063e-02F, 1.563844830e-02F, 3.751654411e-03F, -1.387778781e-17F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMAN_64)
+/** Symmetric blackman window of length 64 */
+static const float32_t blackman_64[64] = {
+    -1.387778781e-17F, 8.984113229e-04F, 3.631853033e-03F, 8.312699385e-03F,
+    1.512083970e-02F, 2.429291420e-02F, 3.610789403e-02F, 5.086963251e-02F,
+    6.888713688e-02F, 9.045342356e-02F, 1.158239022e-01F, 1.451951712e-01F,
+    1.786853373e-01F, 2.163164914e-01F, 2.580004930e-01F, 3.035284877e-01F,
+    3.525647819e-01F, 4.046456814e-01F, 4.591829479e-01F, 5.154727101e-01F,
+    5.727086663e-01F, 6.299999952e-01F, 6.863929033e-01F, 7.408954501e-01F,
+    7.925043702e-01F, 8.402335048e-01F, 8.831422925e-01F, 9.203636050e-01F,
+    9.511298537e-01F, 9.747963548e-01F, 9.908612370e-01F, 9.989809394e-01F,
+    9.989809394e-01F, 9.908612370e-01F, 9.747963548e-01F, 9.511298537e-01F,
+    9.203636050e-01F, 8.831422925e-01F, 8.402335048e-01F, 7.925043702e-01F,
+    7.408954501e-01F, 6.863929033e-01F, 6.299999952e-01F, 5.727086663e-01F,
+    5.154727101e-01F, 4.591829479e-01F, 4.046456814e-01F, 3.525647819e-01F,
+    3.035284877e-01F, 2.580004930e-01F, 2.163164914e-01F, 1.786853373e-01F,
+    1.451951712e-01F, 1.158239022e-01F, 9.045342356e-02F, 6.888713688e-02F,
+    5.086963251e-02F, 3.610789403e-02F, 2.429291420e-02F, 1.512083970e-02F,
+    8.312699385e-03F, 3.631853033e-03F, 8.984113229e-04F, -1.387778781e-17F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMANHARRIS_32)
+/** Symmetric blackmanharris window of length 32 */
+static const float32_t blackmanharris_32[32] = {
+    5.999999848e-05F, 6.991676055e-04F, 3.312811023e-03F, 9.974326938e-03F,
+    2.404092252e-02F, 4.986334965e-02F, 9.217933565e-02F, 1.551523358e-01F,
+    2.411576658e-01F, 3.495663106e-01F, 4.758708179e-01F, 6.114895940e-01F,
+    7.444594502e-01F, 8.610083461e-01F, 9.477534890e-01F, 9.940670729e-01F,
+    9.940670729e-01F, 9.477534890e-01F, 8.610083461e-01F, 7.444594502e-01F,
+    6.114895940e-01F, 4.758708179e-01F, 3.495663106e-01F, 2.411576658e-01F,
+    1.551523358e-01F, 9.217933565e-02F, 4.986334965e-02F, 2.404092252e-02F,
+    9.974326938e-03F, 3.312811023e-03F, 6.991676055e-04F, 5.999999848e-05F,
+};
+#endif
+
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMANHARRIS_64)
+/** Symmetric blackmanharris window of length 64 */
+static const float32_t blackmanharris_64[64] = {
+    5.999999848e-05F, 2.041014086e-04F, 6.772662164e-04F, 1.602007775e-03F,
+    3.182095010e-03F, 5.701276474e-03F, 9.520293213e-03F, 1.507117320e-02F,
+    2.284778096e-02F, 3.339172527e-02F, 4.727298766e-02F, 6.506513804e-02F,
+    8.731538057e-02F, 1.145104170e-01F, 1.470395625e-01F, 1.851570606e-01F,
+    2.289461792e-01F, 2.782873511e-01F, 3.328334987e-01F, 3.919945061e-01F,
+    4.549333155e-01F, 5.205749869e-01F, 5.876293182e-01F, 6.546268463e-01F,
+    7.199674249e-01F, 7.819789648e-01F, 8.389840126e-01F, 8.893697858e-01F,
+    9.316592813e-01F, 9.645779133e-01F, 9.871128201e-01F, 9.985604882e-01F,
+    9.985604882e-01F, 9.871128201e-01F, 9.645779133e-01F, 9.316592813e-01F,
+    8.893697858e-01F, 8.389840126e-01F, 7.819789648e-01F, 7.199674249e-01F,
+    6.546268463e-01F, 5.876293182e-01F, 5.205749869e-01F, 4.549333155e-01F,
+    3.919945061e-01F, 3.328334987e-01F, 2.782873511e-01F, 2.289461792e-01F,
+    1.851570606e-01F, 1.470395625e-01F, 1.145104170e-01F, 8.731538057e-02F,
+    6.506513804e-02F, 4.727298766e-02F, 3.339172527e-02F, 2.284778096e-02F,
+    1.507117320e-02F, 9.520293213e-03F, 5.701276474e-03F, 3.182095010e-03F,
+    1.602007775e-03F, 6.772662164e-04F, 2.041014086e-04F, 5.999999848e-05F,
+};
+#endif
+
+/** Generated windows, terminated by an entry without window */
+static const ifx_window_registry_entry_f32_t window_tables[] = {
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HANN_32)
+    {IFX_WINDOW_HANN, 32U, false, hann_32},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HANN_64)
+    {IFX_WINDOW_HANN, 64U, false, hann_64},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HAMMING_32)
+    {IFX_WINDOW_HAMMING, 32U, false, hamming_32},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_HAMMING_64)
+    {IFX_WINDOW_HAMMING, 64U, false, hamming_64},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMAN_32)
+    {IFX_WINDOW_BLACKMAN, 32U, false, blackman_32},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMAN_64)
+    {IFX_WINDOW_BLACKMAN, 64U, false, blackman_64},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMANHARRIS_32)
+    {IFX_WINDOW_BLACKMANHARRIS, 32U, false, blackmanharris_32},
+#endif
+#if defined(IFX_WINDOW_ALL_TABLES) || defined(IFX_WINDOW_TABLE_BLACKMANHARRIS_64)
+    {IFX_WINDOW_BLACKMANHARRIS, 64U, false, blackmanharris_64},
+#endif
+    {IFX_WINDOW_HANN, 0U, false, NULL}
+};
+
+
+const float32_t* ifx_window_table_get_f32(ifx_window_type_t type, uint32_t len, bool periodic)
+{
+    for (uint32_t i = 0; window_tables[i].win != NULL; ++i)
+    {
+        const ifx_window_registry_entry_f32_t* entry = &window_tables[i];
+
+        if ((entry->type == type) && (entry->len == len) && (entry->periodic == periodic))
+        {
+            return entry->win;
+        }
+    }
+
+    return NULL;
+}
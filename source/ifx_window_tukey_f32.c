@@ -0,0 +1,44 @@
+/***************************************************************************//**
+* \file ifx_window_tukey_f32.c
+*
+* \brief
+* This file contains the implementation for the
+* ifx_window_tukey_f32 function
+*
+*******************************************************************************
+* \copyright
+* Copyright 2022 Infineon Technologies AG
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "ifx_sensor_dsp.h"
+
+void ifx_window_tukey_f32(float32_t* win, uint32_t len, float32_t alpha)
+{
+    assert(win != NULL);
+    assert(len > 1U);
+
+    /* Number of samples of each cosine taper, alpha = 0 is rectangular, alpha = 1 is Hann */
+    const float32_t taper = ((alpha < 1.0F) ? alpha : 1.0F) * ((float32_t)len - 1.0F) / 2.0F;
+
+    /* The window is symmetric, the first half is calculated and mirrored */
+    for (uint32_t n = 0; n < ((len + 1U) / 2U); ++n)
+    {
+        win[n] = ((float32_t)n < taper) ?
+                 (0.5F - (0.5F * arm_cos_f32(PI * (float32_t)n / taper))) : 1.0F;
+        win[len - 1U - n] = win[n];
+    }
+}